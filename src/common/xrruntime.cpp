@@ -6,10 +6,15 @@
 #include <malloc.h>
 #include <sys/stat.h>
 
+#include <chrono>
+
 #ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
 #include <Windows.h>
+#else
+#include <sys/inotify.h>
+#include <unistd.h>
 #endif
 
 #include <nlohmann/json.hpp>
@@ -19,10 +24,66 @@
 #include "xr_runtime_default.h"
 #include "xr_runtime_template.h"
 
+/*** Types *******************************/
+
+// Parsing a manifest is most of what loading the list costs, and they
+// hardly ever change, so names are kept until their file changes.
+struct manifest_cache_t {
+	char     file[1024];
+	uint64_t stamp;
+	char     name[64];
+};
+
+#define RUNTIME_WATCH_MAX 64
+
+struct runtime_watch_file_t {
+	char            file[1024];
+	runtime_change_ change;
+#if defined(_WIN32)
+	uint64_t        stamp;
+#else
+	// Files are watched through their folder, since tools replace them
+	// rather than write them in place. Folders that don't exist yet get
+	// watched through the closest one that does, for the next folder down.
+	int             wd;
+	char            name[256];
+#endif
+};
+
+struct runtime_watch_t {
+	char                 config_file[1024];
+	char                 manifests[RUNTIME_WATCH_MAX][1024];
+	int32_t              manifest_count;
+	runtime_watch_file_t files[RUNTIME_WATCH_MAX * 2];
+	int32_t              file_count;
+	int32_t              pending; // runtime_change_ flags, waiting to settle
+	std::chrono::steady_clock::time_point last_change;
+#if defined(_WIN32)
+	HKEY                 key;
+	HANDLE               key_event;
+	std::chrono::steady_clock::time_point last_check;
+#else
+	int                  fd;
+#endif
+};
+
+/*** Global Variables ********************/
+
+manifest_cache_t *manifest_cache       = nullptr;
+int32_t           manifest_cache_count = 0;
+
+const float runtime_watch_settle_sec = 0.25f;
+
 /*** Signatures **************************/
 
 bool file_exists(const char *file);
 char* read_file(const char* file);
+uint64_t file_stamp(const struct stat *info);
+bool manifest_name(const char *file, const struct stat *info, char *out_name, size_t name_size);
+
+void    runtime_watch_arm (runtime_watch_t *watch);
+void    runtime_watch_file(runtime_watch_t *watch, const char *file, runtime_change_ change);
+int32_t runtime_watch_read(runtime_watch_t *watch);
 
 /*** Code ********************************/
 
@@ -75,6 +136,8 @@ bool load_runtimes(const char *file, runtime_t **out_runtime_list, int32_t *out_
 		if      (strcmp(plat_name,"windows") == 0) runtime.platform = platform_windows;
 		else if (strcmp(plat_name,"linux"  ) == 0) runtime.platform = platform_linux;
 		else continue;
+		// Nothing disables these, whether the file is there is checked below
+		runtime.present = true;
 
 		result_count += 1;
 		result_list = (runtime_t*)realloc(result_list, sizeof(runtime_t) * result_count);
@@ -109,7 +172,7 @@ bool load_runtimes(const char *file, runtime_t **out_runtime_list, int32_t *out_
 				runtime.name[0] = 0;
 				memcpy(runtime.file, path, path_char_count);
 				runtime.file[path_char_count] = '\0';
-				runtime.present = file_exists(runtime.file) && !disabled;
+				runtime.present = !disabled;
 			}
 			path_char_count = sizeof(path);
 			disabled_byte_count = sizeof(disabled);
@@ -134,39 +197,15 @@ bool load_runtimes(const char *file, runtime_t **out_runtime_list, int32_t *out_
 	#endif
 	for (int32_t i=0; i<result_count; i+=1) {
 		auto& runtime = result_list[i];
-		if (runtime.name[0] || !file_exists(runtime.file)) {
+		// One stat per manifest, for whether it's there, and whether the
+		// name we have for it is still good.
+		struct stat info = {};
+		runtime.present = runtime.present && stat(runtime.file, &info) == 0;
+		if (runtime.name[0] || !runtime.present) {
 			continue;
 		}
 
-		// Try to read the name rom the JSON
-		auto json = read_file(runtime.file);
-		if (!json) {
-			continue;
-		}
-		try {
-			const auto manifest = nlohmann::json::parse(json);
-			free(json);	
-			json = nullptr;
-			if (manifest.contains("runtime")) {
-				const auto& runtime_metadata = manifest.at("runtime");
-				if (runtime_metadata.contains("name")) {
-					const auto& name = runtime_metadata.at("name");
-					if (name.is_string()) {
-						auto str = name.get<std::string>();
-						// Include trailing null in copy
-						if (str.size() + 1 <= sizeof(runtime.name)) {
-							memcpy(runtime.name, str.c_str(), str.size() + 1);
-						}
-					}
-				}
-			}
-		} catch (const nlohmann::json::exception&) {
-			if (json) {
-				free(json);
-			}
-		}
-
-		if (runtime.name[0]) {
+		if (manifest_name(runtime.file, &info, runtime.name, sizeof(runtime.name))) {
 			continue;
 		}
 
@@ -196,7 +235,7 @@ bool load_runtimes(const char *file, runtime_t **out_runtime_list, int32_t *out_
 		result_list[i].present = 
 			!exists &&
 			result_list[i].platform == curr_platform && 
-			file_exists(result_list[i].file);
+			result_list[i].present;
 	}
 
 	*out_runtime_list  = result_list;
@@ -206,6 +245,321 @@ bool load_runtimes(const char *file, runtime_t **out_runtime_list, int32_t *out_
 
 ///////////////////////////////////////////
 
+bool manifest_name(const char *file, const struct stat *info, char *out_name, size_t name_size) {
+	uint64_t          stamp = file_stamp(info);
+	manifest_cache_t *entry = nullptr;
+	for (int32_t i = 0; i < manifest_cache_count; i++) {
+		if (strcmp(manifest_cache[i].file, file) == 0) {
+			entry = &manifest_cache[i];
+			break;
+		}
+	}
+	if (entry != nullptr && entry->stamp == stamp) {
+		snprintf(out_name, name_size, "%s", entry->name);
+		return entry->name[0] != '\0';
+	}
+	if (entry == nullptr) {
+		manifest_cache_count += 1;
+		manifest_cache = (manifest_cache_t*)realloc(manifest_cache, sizeof(manifest_cache_t) * manifest_cache_count);
+		entry = &manifest_cache[manifest_cache_count - 1];
+		*entry = {};
+		snprintf(entry->file, sizeof(entry->file), "%s", file);
+	}
+	// Manifests without a name are remembered too, so they aren't parsed
+	// again either.
+	entry->stamp   = stamp;
+	entry->name[0] = '\0';
+
+	// Try to read the name rom the JSON
+	auto json = read_file(file);
+	if (!json) {
+		return false;
+	}
+	try {
+		const auto manifest = nlohmann::json::parse(json);
+		free(json);	
+		json = nullptr;
+		if (manifest.contains("runtime")) {
+			const auto& runtime_metadata = manifest.at("runtime");
+			if (runtime_metadata.contains("name")) {
+				const auto& name = runtime_metadata.at("name");
+				if (name.is_string()) {
+					auto str = name.get<std::string>();
+					// Include trailing null in copy
+					if (str.size() + 1 <= sizeof(entry->name)) {
+						memcpy(entry->name, str.c_str(), str.size() + 1);
+					}
+				}
+			}
+		}
+	} catch (const nlohmann::json::exception&) {
+		if (json) {
+			free(json);
+		}
+	}
+
+	snprintf(out_name, name_size, "%s", entry->name);
+	return entry->name[0] != '\0';
+}
+
+///////////////////////////////////////////
+
+runtime_watch_t *runtime_watch_create(const char *config_file) {
+	runtime_watch_t *watch = (runtime_watch_t*)calloc(1, sizeof(runtime_watch_t));
+	snprintf(watch->config_file, sizeof(watch->config_file), "%s", config_file);
+#if !defined(_WIN32)
+	watch->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+	runtime_watch_arm(watch);
+	return watch;
+}
+
+///////////////////////////////////////////
+
+void runtime_watch_list(runtime_watch_t *watch, const runtime_t *runtime_list, int32_t runtime_count) {
+#if defined(_WIN32)
+	platform_ curr_platform = platform_windows;
+#else
+	platform_ curr_platform = platform_linux;
+#endif
+	// Runtimes that aren't installed are watched too, so they show up
+	// once they are.
+	watch->manifest_count = 0;
+	for (int32_t i = 0; i < runtime_count && watch->manifest_count < RUNTIME_WATCH_MAX; i++) {
+		if (runtime_list[i].platform != curr_platform) continue;
+		snprintf(watch->manifests[watch->manifest_count], sizeof(watch->manifests[0]), "%s", runtime_list[i].file);
+		watch->manifest_count += 1;
+	}
+	runtime_watch_arm(watch);
+}
+
+///////////////////////////////////////////
+
+int32_t runtime_watch_poll(runtime_watch_t *watch) {
+	auto    now     = std::chrono::steady_clock::now();
+	int32_t changes = runtime_watch_read(watch);
+	if (changes != runtime_change_none) {
+		watch->pending    |= changes;
+		watch->last_change = now;
+		// What needs watching can move with a change, like the active
+		// runtime pointing at a new manifest, or a folder showing up.
+		runtime_watch_arm(watch);
+	}
+
+	if (watch->pending == runtime_change_none || std::chrono::duration<float>(now - watch->last_change).count() < runtime_watch_settle_sec)
+		return runtime_change_none;
+	int32_t result = watch->pending;
+	watch->pending = runtime_change_none;
+	return result;
+}
+
+///////////////////////////////////////////
+
+void runtime_watch_clear(runtime_watch_t *watch) {
+	if (runtime_watch_read(watch) != runtime_change_none)
+		runtime_watch_arm(watch);
+	watch->pending = runtime_change_none;
+}
+
+///////////////////////////////////////////
+
+void runtime_watch_destroy(runtime_watch_t *watch) {
+	if (watch == nullptr) return;
+#if defined(_WIN32)
+	if (watch->key_event) CloseHandle(watch->key_event);
+	if (watch->key      ) RegCloseKey(watch->key);
+#else
+	if (watch->fd >= 0) close(watch->fd);
+#endif
+	free(watch);
+}
+
+///////////////////////////////////////////
+
+#if defined(_WIN32)
+
+void runtime_watch_arm(runtime_watch_t *watch) {
+	watch->file_count = 0;
+	runtime_watch_file(watch, watch->config_file, runtime_change_list);
+	for (int32_t i = 0; i < watch->manifest_count; i++)
+		runtime_watch_file(watch, watch->manifests[i], runtime_change_list);
+
+	// The active runtime is a registry value, which is watched along with
+	// the rest of the key, but the manifest it names is a file.
+	char  active[1024];
+	DWORD active_size = sizeof(active);
+	if (RegGetValueA(HKEY_LOCAL_MACHINE, "SOFTWARE\\Khronos\\OpenXR\\1", "ActiveRuntime", RRF_RT_REG_SZ, nullptr, active, &active_size) == ERROR_SUCCESS)
+		runtime_watch_file(watch, active, runtime_change_active);
+
+	if (watch->key == nullptr) {
+		if (RegOpenKeyExA(HKEY_LOCAL_MACHINE, "SOFTWARE\\Khronos\\OpenXR\\1", 0, KEY_NOTIFY, &watch->key) != ERROR_SUCCESS)
+			watch->key = nullptr;
+	}
+	if (watch->key != nullptr && watch->key_event == nullptr) {
+		watch->key_event = CreateEventA(nullptr, FALSE, FALSE, nullptr);
+		RegNotifyChangeKeyValue(watch->key, TRUE, REG_NOTIFY_CHANGE_NAME | REG_NOTIFY_CHANGE_LAST_SET, watch->key_event, TRUE);
+	}
+}
+
+///////////////////////////////////////////
+
+void runtime_watch_file(runtime_watch_t *watch, const char *file, runtime_change_ change) {
+	if (watch->file_count >= (int32_t)(sizeof(watch->files) / sizeof(watch->files[0]))) return;
+
+	runtime_watch_file_t *item = &watch->files[watch->file_count];
+	*item = {};
+	snprintf(item->file, sizeof(item->file), "%s", file);
+	item->change = change;
+	struct stat info = {};
+	item->stamp = stat(file, &info) == 0 ? file_stamp(&info) : 0;
+	watch->file_count += 1;
+}
+
+///////////////////////////////////////////
+
+int32_t runtime_watch_read(runtime_watch_t *watch) {
+	int32_t changes = runtime_change_none;
+	if (watch->key_event && WaitForSingleObject(watch->key_event, 0) == WAIT_OBJECT_0) {
+		changes |= runtime_change_list | runtime_change_active;
+		// Notifications only fire once, so ask for the next one
+		RegNotifyChangeKeyValue(watch->key, TRUE, REG_NOTIFY_CHANGE_NAME | REG_NOTIFY_CHANGE_LAST_SET, watch->key_event, TRUE);
+	}
+
+	// Nothing waits on a list of scattered files nicely, but a stat of
+	// each one every second is next to free.
+	auto now = std::chrono::steady_clock::now();
+	if (std::chrono::duration<float>(now - watch->last_check).count() < 1) return changes;
+	watch->last_check = now;
+	for (int32_t i = 0; i < watch->file_count; i++) {
+		struct stat info  = {};
+		uint64_t    stamp = stat(watch->files[i].file, &info) == 0 ? file_stamp(&info) : 0;
+		if (stamp != watch->files[i].stamp)
+			changes |= watch->files[i].change;
+	}
+	return changes;
+}
+
+#else
+
+void runtime_watch_arm(runtime_watch_t *watch) {
+	watch->file_count = 0;
+	runtime_watch_file(watch, watch->config_file, runtime_change_list);
+	for (int32_t i = 0; i < watch->manifest_count; i++)
+		runtime_watch_file(watch, watch->manifests[i], runtime_change_list);
+
+	// The same places the loader looks, XR_RUNTIME_JSON wins over all of
+	// them.
+	char        path[1024];
+	const char *env = getenv("XR_RUNTIME_JSON");
+	if (env && env[0]) {
+		runtime_watch_file(watch, env, runtime_change_active);
+	} else {
+		const char *config_home = getenv("XDG_CONFIG_HOME");
+		const char *home        = getenv("HOME");
+		if      (config_home && config_home[0]) { snprintf(path, sizeof(path), "%s/openxr/1/active_runtime.json", config_home);   runtime_watch_file(watch, path, runtime_change_active); }
+		else if (home        && home[0])        { snprintf(path, sizeof(path), "%s/.config/openxr/1/active_runtime.json", home); runtime_watch_file(watch, path, runtime_change_active); }
+
+		const char *config_dirs = getenv("XDG_CONFIG_DIRS");
+		if (config_dirs == nullptr || config_dirs[0] == '\0') config_dirs = "/etc/xdg";
+		for (const char *dir = config_dirs; *dir; ) {
+			size_t length = strcspn(dir, ":");
+			if (length > 0) {
+				snprintf(path, sizeof(path), "%.*s/openxr/1/active_runtime.json", (int)length, dir);
+				runtime_watch_file(watch, path, runtime_change_active);
+			}
+			dir += dir[length] == ':' ? length + 1 : length;
+		}
+		runtime_watch_file(watch, "/etc/openxr/1/active_runtime.json", runtime_change_active);
+	}
+
+	// Active runtimes are usually a symlink, and what it links to can
+	// change without the link changing.
+	int32_t active_count = watch->file_count;
+	for (int32_t i = 0; i < active_count; i++) {
+		if (watch->files[i].change != runtime_change_active) continue;
+		char *target = realpath(watch->files[i].file, nullptr);
+		if (target && strcmp(target, watch->files[i].file) != 0)
+			runtime_watch_file(watch, target, runtime_change_active);
+		free(target);
+	}
+}
+
+///////////////////////////////////////////
+
+void runtime_watch_file(runtime_watch_t *watch, const char *file, runtime_change_ change) {
+	if (watch->fd < 0 || watch->file_count >= (int32_t)(sizeof(watch->files) / sizeof(watch->files[0]))) return;
+
+	runtime_watch_file_t *item = &watch->files[watch->file_count];
+	*item = {};
+	snprintf(item->file, sizeof(item->file), "%s", file);
+	item->change = change;
+
+	// Walk up from the file until there's a folder to watch, whatever's
+	// below it is what to look out for.
+	char folder[1024];
+	snprintf(folder, sizeof(folder), "%s", file);
+	for (;;) {
+		char *slash = strrchr(folder, '/');
+		if (slash == nullptr || slash[1] == '\0') return;
+		snprintf(item->name, sizeof(item->name), "%s", slash + 1);
+		slash[slash == folder ? 1 : 0] = '\0';
+
+		struct stat info = {};
+		if (stat(folder, &info) == 0 && S_ISDIR(info.st_mode)) break;
+	}
+
+	// Watching a folder twice gives back the same wd, and folders that
+	// stop being interesting are left watched, it's harmless. Removing
+	// them would mean missing whatever happens until they're added back.
+	item->wd = inotify_add_watch(watch->fd, folder,
+		IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_CLOSE_WRITE | IN_ATTRIB |
+		IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR);
+	if (item->wd >= 0)
+		watch->file_count += 1;
+}
+
+///////////////////////////////////////////
+
+int32_t runtime_watch_read(runtime_watch_t *watch) {
+	if (watch->fd < 0) return runtime_change_none;
+
+	int32_t changes = runtime_change_none;
+	alignas(struct inotify_event) char buffer[4096];
+	ssize_t length;
+	while ((length = read(watch->fd, buffer, sizeof(buffer))) > 0) {
+		for (char *at = buffer; at < buffer + length; ) {
+			const struct inotify_event *event = (const struct inotify_event *)at;
+			at += sizeof(struct inotify_event) + event->len;
+
+			if (event->mask & IN_Q_OVERFLOW) {
+				changes |= runtime_change_list | runtime_change_active;
+				continue;
+			}
+			// A watched folder going away counts for everything in it
+			bool folder_gone = (event->mask & (IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF)) != 0;
+			for (int32_t i = 0; i < watch->file_count; i++) {
+				const runtime_watch_file_t *item = &watch->files[i];
+				if (item->wd != event->wd) continue;
+
+				// Newer loaders also look for active_runtime.<arch>.json
+				const char *name    = event->len > 0 ? event->name : "";
+				bool        matches = strcmp(item->name, name) == 0;
+				if (!matches && strcmp(item->name, "active_runtime.json") == 0) {
+					size_t name_length = strlen(name);
+					matches = strncmp(name, "active_runtime.", 15) == 0 && name_length > 5 && strcmp(&name[name_length - 5], ".json") == 0;
+				}
+				if (matches || folder_gone)
+					changes |= item->change;
+			}
+		}
+	}
+	return changes;
+}
+
+#endif
+
+///////////////////////////////////////////
+
 void ensure_runtime_config_exists(const char *at_file) {
 	if (file_exists(at_file))
 		return;
@@ -251,6 +605,22 @@ bool file_exists(const char *file) {
 	return (stat (file, &buffer) == 0);
 }
 
+///////////////////////////////////////////
+
+uint64_t file_stamp(const struct stat *info) {
+	// Tools usually replace files rather than write over them, which
+	// changes the inode even when the time and size come out the same.
+	uint64_t mtime_ns = (uint64_t)info->st_mtime * 1000000000ull;
+#if defined(__linux__)
+	mtime_ns += (uint64_t)info->st_mtim.tv_nsec;
+#endif
+	const uint64_t values[] = { mtime_ns, (uint64_t)info->st_size, (uint64_t)info->st_ino };
+	uint64_t       hash     = 14695981039346656037ull;
+	for (size_t i = 0; i < sizeof(values)/sizeof(values[0]); i++)
+		hash = (hash ^ values[i]) * 1099511628211ull;
+	return hash;
+}
+
 char* read_file(const char* file) {
 	FILE* fp = fopen(file, "r");
 	if (!fp) {
@@ -18,8 +18,30 @@ typedef struct runtime_t {
 	bool      present;
 } runtime_t;
 
+typedef enum runtime_change_ {
+	runtime_change_none   = 0,
+	runtime_change_list   = 1 << 0, // The runtime list, or a manifest on it
+	runtime_change_active = 1 << 1, // Which runtime is active, or its manifest
+} runtime_change_;
+
+// Watches the runtime list, the manifests on it, and the active runtime, so
+// changes from other tools show up without a manual reload. Linux gets told
+// by inotify, Windows by the registry and an occasional stat of each file.
+// Tools tend to write these in a few steps, so changes are only reported
+// once they've settled.
+typedef struct runtime_watch_t runtime_watch_t;
+
 /*** Signatures **************************/
 
 const char *runtime_config_path();
 void ensure_runtime_config_exists(const char *at_file);
-bool load_runtimes(const char *file, runtime_t **out_runtime_list, int32_t *out_runtime_count);
\ No newline at end of file
+bool load_runtimes(const char *file, runtime_t **out_runtime_list, int32_t *out_runtime_count);
+
+runtime_watch_t *runtime_watch_create (const char *config_file);
+// Watches the manifests on this list instead of the last one
+void             runtime_watch_list   (runtime_watch_t *watch, const runtime_t *runtime_list, int32_t runtime_count);
+// runtime_change_ flags for what changed since the last poll, never blocks
+int32_t          runtime_watch_poll   (runtime_watch_t *watch);
+// Forgets about changes so far, for changes we made ourselves
+void             runtime_watch_clear  (runtime_watch_t *watch);
+void             runtime_watch_destroy(runtime_watch_t *watch);
@@ -0,0 +1,287 @@
+#include "xrsnapshot.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+/*** Types *******************************/
+
+// On-disk layout, everything is little endian and 8 byte aligned so the
+// record payloads can be used straight out of the loaded file:
+//
+// [snapshot_file_header_t]
+// [snapshot_file_record_t][name, padded][data, padded] ...
+struct snapshot_file_header_t {
+	char     magic[8];
+	uint32_t version;
+	uint32_t record_count;
+};
+
+struct snapshot_file_record_t {
+	uint64_t key;
+	uint64_t time_ns;
+	int32_t  result;
+	uint32_t name_size;
+	uint32_t item_size;
+	uint32_t item_count;
+};
+
+// Writer chunks are zero filled, and a record always has a name, so a zero
+// name_size marks the end of the records in a chunk.
+struct snapshot_chunk_t {
+	std::atomic<size_t> used;
+	size_t              capacity;
+	snapshot_chunk_t   *prev;
+	uint8_t            *data;
+};
+
+struct snapshot_writer_t {
+	std::atomic<snapshot_chunk_t *> chunk;
+	std::atomic<uint32_t>           record_count;
+	std::chrono::steady_clock::time_point start;
+};
+
+/*** Global Variables ********************/
+
+const char     snapshot_magic[8]   = { 'X','R','S','N','A','P','\0','\0' };
+const uint32_t snapshot_version    = 4;
+const size_t   snapshot_chunk_size = 1024 * 1024;
+
+/*** Code ********************************/
+
+static size_t snapshot_align(size_t size) { return (size + 7) & ~(size_t)7; }
+
+///////////////////////////////////////////
+
+uint64_t snapshot_hash(const char *func) {
+	uint64_t hash = 14695981039346656037UL;
+	while (*func) {
+		hash = (hash ^ (uint8_t)*func) * 1099511628211;
+		func++;
+	}
+	return hash;
+}
+
+///////////////////////////////////////////
+
+const snapshot_record_t *snapshot_find(const snapshot_t *snapshot, const char *func, uint64_t key) {
+	uint64_t hash = snapshot_hash(func);
+	// Search from the back, so a later record for the same call wins
+	for (int32_t i = snapshot->record_count-1; i >= 0; i--) {
+		const snapshot_record_t *record = &snapshot->records[i];
+		if (record->func_hash == hash && record->key == key && strcmp(record->func, func) == 0)
+			return record;
+	}
+	return nullptr;
+}
+
+///////////////////////////////////////////
+
+bool snapshot_load(const char *file, snapshot_t *out_snapshot) {
+	*out_snapshot = {};
+
+	FILE *fp = fopen(file, "rb");
+	if (fp == nullptr)
+		return false;
+
+	fseek(fp, 0, SEEK_END);
+	size_t size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+
+	uint8_t *file_data = (uint8_t*)malloc(size);
+	size_t   read      = fread(file_data, 1, size, fp);
+	fclose(fp);
+
+	snapshot_file_header_t header = {};
+	if (read != size || size < sizeof(header)) {
+		free(file_data);
+		return false;
+	}
+	memcpy(&header, file_data, sizeof(header));
+	if (memcmp(header.magic, snapshot_magic, sizeof(header.magic)) != 0 || header.version != snapshot_version) {
+		free(file_data);
+		return false;
+	}
+
+	snapshot_t result = {};
+	result.file_data       = file_data;
+	result.record_capacity = (int32_t)header.record_count;
+	result.records         = (snapshot_record_t*)malloc(sizeof(snapshot_record_t) * (header.record_count > 0 ? header.record_count : 1));
+
+	size_t at = sizeof(header);
+	for (uint32_t i = 0; i < header.record_count; i++) {
+		snapshot_file_record_t file_record = {};
+		if (at + sizeof(file_record) > size) break;
+		memcpy(&file_record, file_data + at, sizeof(file_record));
+		at += sizeof(file_record);
+
+		size_t data_size = (size_t)file_record.item_size * file_record.item_count;
+		if (file_record.name_size == 0 || at + snapshot_align(file_record.name_size) + data_size > size) break;
+		if (file_data[at + file_record.name_size - 1] != '\0') break;
+
+		snapshot_record_t record = {};
+		record.func       = (const char *)(file_data + at);
+		record.func_hash  = snapshot_hash(record.func);
+		record.key        = file_record.key;
+		record.time_ns    = file_record.time_ns;
+		record.result     = file_record.result;
+		record.item_size  = file_record.item_size;
+		record.item_count = file_record.item_count;
+		at += snapshot_align(file_record.name_size);
+		record.data       = data_size > 0 ? file_data + at : nullptr;
+		at += snapshot_align(data_size);
+
+		result.records[result.record_count] = record;
+		result.record_count += 1;
+	}
+
+	*out_snapshot = result;
+	return true;
+}
+
+///////////////////////////////////////////
+
+void snapshot_free(snapshot_t *snapshot) {
+	free(snapshot->records);
+	free(snapshot->file_data);
+	*snapshot = {};
+}
+
+///////////////////////////////////////////
+
+static snapshot_chunk_t *snapshot_chunk_create(size_t capacity, snapshot_chunk_t *prev) {
+	snapshot_chunk_t *chunk = new snapshot_chunk_t();
+	chunk->used     = 0;
+	chunk->capacity = capacity;
+	chunk->prev     = prev;
+	chunk->data     = (uint8_t*)calloc(1, capacity);
+	return chunk;
+}
+
+///////////////////////////////////////////
+
+snapshot_writer_t *snapshot_writer_create() {
+	snapshot_writer_t *writer = new snapshot_writer_t();
+	writer->chunk        = snapshot_chunk_create(snapshot_chunk_size, nullptr);
+	writer->record_count = 0;
+	writer->start        = std::chrono::steady_clock::now();
+	return writer;
+}
+
+///////////////////////////////////////////
+
+void snapshot_writer_add(snapshot_writer_t *writer, const char *func, uint64_t key, int32_t result, const void *items, uint32_t item_size, uint32_t item_count) {
+	if (items == nullptr || item_size == 0)
+		item_count = 0;
+
+	size_t name_size   = strlen(func) + 1;
+	size_t data_size   = (size_t)item_size * item_count;
+	size_t record_size = sizeof(snapshot_file_record_t) + snapshot_align(name_size) + snapshot_align(data_size);
+
+	snapshot_file_record_t file_record = {};
+	file_record.key        = key;
+	file_record.result     = result;
+	file_record.name_size  = (uint32_t)name_size;
+	file_record.item_size  = item_size;
+	file_record.item_count = item_count;
+
+	// Reserve space in the current chunk, or swap in a fresh chunk if it's
+	// full. Whoever loses the swap just frees theirs and tries again.
+	uint8_t *dest = nullptr;
+	while (dest == nullptr) {
+		snapshot_chunk_t *chunk = writer->chunk.load(std::memory_order_acquire);
+		size_t            at    = chunk->used.fetch_add(record_size, std::memory_order_relaxed);
+		if (at + record_size <= chunk->capacity) {
+			dest = chunk->data + at;
+			break;
+		}
+
+		snapshot_chunk_t *next = snapshot_chunk_create(record_size > snapshot_chunk_size ? record_size : snapshot_chunk_size, chunk);
+		next->used = record_size;
+		if (writer->chunk.compare_exchange_strong(chunk, next, std::memory_order_acq_rel)) {
+			dest = next->data;
+		} else {
+			free(next->data);
+			delete next;
+		}
+	}
+
+	// Timed once the slot is ours, which keeps threads close to slot order,
+	// save sorts out whatever's left.
+	file_record.time_ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - writer->start).count();
+	memcpy(dest, &file_record, sizeof(file_record));
+	memcpy(dest + sizeof(file_record), func, name_size);
+	if (data_size > 0)
+		memcpy(dest + sizeof(file_record) + snapshot_align(name_size), items, data_size);
+	writer->record_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+///////////////////////////////////////////
+
+// Call this once all threads adding records are done.
+bool snapshot_writer_save(snapshot_writer_t *writer, const char *file) {
+	FILE *fp = fopen(file, "wb");
+	if (fp == nullptr)
+		return false;
+
+	snapshot_file_header_t header = {};
+	memcpy(header.magic, snapshot_magic, sizeof(header.magic));
+	header.version      = snapshot_version;
+	header.record_count = writer->record_count.load();
+	fwrite(&header, sizeof(header), 1, fp);
+
+	// Chunks link backwards, flip them around so records stay in call order
+	int32_t chunk_count = 0;
+	for (snapshot_chunk_t *chunk = writer->chunk.load(); chunk != nullptr; chunk = chunk->prev)
+		chunk_count++;
+	snapshot_chunk_t **chunks = (snapshot_chunk_t**)malloc(sizeof(snapshot_chunk_t*) * chunk_count);
+	int32_t            curr   = chunk_count;
+	for (snapshot_chunk_t *chunk = writer->chunk.load(); chunk != nullptr; chunk = chunk->prev)
+		chunks[--curr] = chunk;
+
+	// Threads can still land in a slot a little out of time order, so the
+	// records get sorted by time, ties keep the order they were added in.
+	struct saved_record_t { const uint8_t *data; size_t size; uint64_t time_ns; };
+	saved_record_t *records = (saved_record_t*)malloc(sizeof(saved_record_t) * (header.record_count > 0 ? header.record_count : 1));
+	uint32_t        count   = 0;
+	for (int32_t i = 0; i < chunk_count; i++) {
+		snapshot_chunk_t *chunk = chunks[i];
+		size_t            end   = chunk->used.load() < chunk->capacity ? chunk->used.load() : chunk->capacity;
+		size_t            at    = 0;
+		while (at + sizeof(snapshot_file_record_t) <= end && count < header.record_count) {
+			snapshot_file_record_t file_record;
+			memcpy(&file_record, chunk->data + at, sizeof(file_record));
+			if (file_record.name_size == 0) break;
+			size_t size = sizeof(file_record) + snapshot_align(file_record.name_size) + snapshot_align((size_t)file_record.item_size * file_record.item_count);
+			records[count++] = { chunk->data + at, size, file_record.time_ns };
+			at += size;
+		}
+	}
+	std::stable_sort(records, records + count, [](const saved_record_t &a, const saved_record_t &b) { return a.time_ns < b.time_ns; });
+	for (uint32_t i = 0; i < count; i++)
+		fwrite(records[i].data, records[i].size, 1, fp);
+	free(records);
+	free(chunks);
+
+	bool result = ferror(fp) == 0;
+	fclose(fp);
+	return result;
+}
+
+///////////////////////////////////////////
+
+void snapshot_writer_destroy(snapshot_writer_t *writer) {
+	snapshot_chunk_t *chunk = writer->chunk.load();
+	while (chunk != nullptr) {
+		snapshot_chunk_t *prev = chunk->prev;
+		free(chunk->data);
+		delete chunk;
+		chunk = prev;
+	}
+	delete writer;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*** Types *******************************/
+
+// A snapshot is a flat list of recorded OpenXR call results. Each record is
+// keyed by the function name, and a function specific 64 bit key (a view
+// configuration type, a structure type, an XrPath, etc.). The payload is the
+// raw array of items that the function wrote out.
+//
+// Records are stored in the order the calls were made, along with the time
+// of each call, so a snapshot doubles as a call trace of the session that
+// produced it.
+typedef struct snapshot_record_t {
+	const char *func;
+	uint64_t    func_hash;
+	uint64_t    key;
+	uint64_t    time_ns;
+	int32_t     result;
+	uint32_t    item_size;
+	uint32_t    item_count;
+	const void *data;
+} snapshot_record_t;
+
+typedef struct snapshot_t {
+	snapshot_record_t *records;
+	int32_t            record_count;
+	int32_t            record_capacity;
+	void              *file_data;
+} snapshot_t;
+
+// Records calls straight into their on-disk layout. Adding a record only
+// reserves space with an atomic add, so it's safe to call from multiple
+// threads, and never blocks or touches the disk.
+typedef struct snapshot_writer_t snapshot_writer_t;
+
+// Calls that are made once per system fold the system's form factor into
+// the top byte of their key, so captures from several systems don't land
+// on each other. That leaves the call 56 bits of its own.
+inline uint64_t snapshot_system_key(uint32_t form, uint64_t key) {
+	return ((uint64_t)form << 56) | (key & 0x00FFFFFFFFFFFFFFull);
+}
+
+/*** Signatures **************************/
+
+uint64_t                 snapshot_hash(const char *func);
+const snapshot_record_t *snapshot_find(const snapshot_t *snapshot, const char *func, uint64_t key);
+bool                     snapshot_load(const char *file, snapshot_t *out_snapshot);
+void                     snapshot_free(snapshot_t *snapshot);
+
+snapshot_writer_t *snapshot_writer_create ();
+void               snapshot_writer_add    (snapshot_writer_t *writer, const char *func, uint64_t key, int32_t result, const void *items, uint32_t item_size, uint32_t item_count);
+bool               snapshot_writer_save   (snapshot_writer_t *writer, const char *file);
+void               snapshot_writer_destroy(snapshot_writer_t *writer);
@@ -1,10 +1,22 @@
 #include "app_cli.h"
 #include "array.h"
 #include "openxr_info.h"
+#include "xrsnapshot.h"
+#include "openxr_metrics.h"
+#include "openxr_live.h"
+#include "openxr_events.h"
+#include "openxr_paths.h"
+#include "openxr_enums.h"
+#include "openxr_spec.h"
+#include "imgui/sokol_time.h"
 
 #include <stdbool.h>
 #include <stdio.h>
 #include <ctype.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <thread>
 
 /*** Types *******************************/
 
@@ -15,10 +27,29 @@ struct command_t {
 	void      (*show)();
 };
 
+/*** Global Variables ********************/
+
+bool cli_graphics_ready = false;
+bool cli_csv            = false;
+
 /*** Signatures **************************/
 
 void cli_print_table(const display_table_t *table);
+void cli_print_csv  (const display_table_t *table);
+void cli_print_trace(const char *file);
+void cli_describe   (const char *name);
+void cli_stream_metrics(float rate_hz, float duration_sec);
+void cli_run_live_test (int32_t test, float duration_sec);
+void cli_stream_events (float duration_sec);
+void cli_print_json_value (const char *text);
+void cli_print_json_string(const char *text);
+int32_t cli_find_live_test(const char *name);
+bool cli_pick_enum(const char *name, xr_settings_t *ref_settings);
+display_table_t *cli_find_table(const char *name);
+bool cli_table_is(const display_table_t *table, const char *name);
 void cli_show_help();
+void cli_print_timings();
+bool cli_init_graphics();
 int32_t strcmp_nocase(char const *a, char const *b);
 
 /*** Code ********************************/
@@ -27,13 +58,54 @@ void app_cli(int32_t arg_count, const char **args) {
 	xr_settings_t settings = {};
 	settings.allow_session = false;
 	settings.form          = XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY;
+	settings.init_graphics = cli_init_graphics;
+	bool    show_timings   = false;
+	int32_t describe_args  = 0;
+	// Naming a form factor or view configuration narrows the tables down
+	// to just that one, otherwise every system and configuration shows.
+	bool    filter_form    = false;
+	bool    filter_view    = false;
 
-	if (!skg_init("OpenXR Explorer", nullptr))
-		printf("Failed to init skg!\n");
+	// Capturing a snapshot wants everything, including session data, and
+	// replays need to be set up before the loader looks for a runtime.
+	for (size_t i = 1; i < arg_count; i++) {
+		const char *curr = args[i];
+		while (*curr == '-') curr++;
+		if (strcmp_nocase("capture", curr) == 0 && i+1 < arg_count) {
+			settings.capture_file  = args[i+1];
+			settings.allow_session = true;
+		} else if (strcmp_nocase("replay", curr) == 0 && i+1 < arg_count) {
+			openxr_replay(args[i+1]);
+			settings.allow_session = true;
+		} else if (strcmp_nocase("serial", curr) == 0) {
+			settings.serial = true;
+		} else if (strcmp_nocase("timing", curr) == 0) {
+			show_timings = true;
+		} else if (strcmp_nocase("csv", curr) == 0) {
+			cli_csv = true;
+		} else if (strcmp_nocase("describe", curr) == 0 && i+1 < arg_count) {
+			// The name could be an enum value, which isn't a setting here
+			describe_args += 2;
+			i++;
+		} else if (strcmp_nocase("session", curr) == 0 || (strcmp_nocase("metrics", curr) == 0 && i+2 < arg_count) || (strcmp_nocase("events", curr) == 0 && i+1 < arg_count) || cli_find_live_test(curr) >= 0) {
+			settings.allow_session = true;
+		} else if (enums_value(curr, &settings.form)) {
+			filter_form = true;
+		} else if (enums_value(curr, &settings.view_config)) {
+			filter_view = true;
+		}
+	}
+
+	// The spec index doesn't need a runtime, so don't start one just for it
+	if (describe_args > 0 && describe_args == arg_count - 1) {
+		for (size_t i = 1; i + 1 < arg_count; i += 2)
+			cli_describe(args[i+1]);
+		return;
+	}
+
+	// Graphics get initialized by cli_init_graphics, and only if a session
+	// turns out to need them.
 	openxr_info_reload(settings);
-	if (xr_instance_err) printf("XrInstance error: [%s]\n", xr_instance_err);
-	if (xr_system_err)   printf("XrSystemId error: [%s]\n", xr_system_err);
-	if (xr_session_err)  printf("XrSession error: [%s]\n", xr_session_err);
 
 	// Find all the commands we want to execute
 	bool show = false;
@@ -44,22 +116,105 @@ void app_cli(int32_t arg_count, const char **args) {
 		if (strcmp_nocase("help", curr) == 0 || strcmp_nocase("h", curr) == 0 || strcmp_nocase("/h", curr) == 0) {
 			cli_show_help();
 			show = true;
-		} else {
+		} else if (strcmp_nocase("capture", curr) == 0 && i+1 < arg_count) {
+			// Already captured during the reload
+			show = true;
+			i++;
+		} else if (strcmp_nocase("replay", curr) == 0 && i+1 < arg_count) {
+			// Replays still want a table or two to show
+			i++;
+		} else if (strcmp_nocase("serial", curr) == 0 || strcmp_nocase("timing", curr) == 0 || strcmp_nocase("csv", curr) == 0 || strcmp_nocase("session", curr) == 0) {
+			// Already applied to the reload
+		} else if (strcmp_nocase("describe", curr) == 0 && i+1 < arg_count) {
+			cli_describe(args[i+1]);
+			show = true;
+			i++;
+		} else if (cli_pick_enum(curr, nullptr)) {
+			// Also applied to the reload, and checked before the tables,
+			// since looking for a table that isn't there loads all of them.
+		} else if (strcmp_nocase("trace", curr) == 0 && i+1 < arg_count) {
+			cli_print_trace(args[i+1]);
+			show = true;
+			i++;
+		} else if (strcmp_nocase("metrics", curr) == 0 && i+2 < arg_count) {
+			cli_stream_metrics((float)atof(args[i+1]), (float)atof(args[i+2]));
+			show = true;
+			i += 2;
+		} else if (strcmp_nocase("events", curr) == 0 && i+1 < arg_count) {
+			cli_stream_events((float)atof(args[i+1]));
+			show = true;
+			i++;
+		} else if (cli_find_live_test(curr) >= 0) {
+			// The duration is optional
+			int32_t test     = cli_find_live_test(curr);
+			float   duration = live_test_get(test)->default_duration;
+			if (i+1 < arg_count && atof(args[i+1]) > 0) {
+				duration = (float)atof(args[i+1]);
+				i++;
+			}
+			cli_run_live_test(test, duration);
+			show = true;
+		} else if (cli_find_table(curr) != nullptr) {
+			// Some tables come once per system or view configuration
 			for (size_t c = 0; c < xr_tables.count; c++) {
-				if ((xr_tables[c].name_func && strcmp_nocase(xr_tables[c].name_func, curr) == 0) ||
-					(xr_tables[c].name_type && strcmp_nocase(xr_tables[c].name_type, curr) == 0)) {
-					cli_print_table(&xr_tables[c]);
-					show = true;
-					break;
-				}
+				const display_table_t *table = &xr_tables[c];
+				if (!cli_table_is(table, curr)) continue;
+				if (filter_form && table->form        != 0 && table->form        != xr_settings.form          ) continue;
+				if (filter_view && table->view_config != 0 && table->view_config != xr_view.current_config) continue;
+				cli_print_table(table);
 			}
+			show = true;
 		}
 	}
-	if (!show)
+	// Timings on their own are a fine thing to ask for
+	if (!show && !show_timings)
 		cli_show_help();
 
+	// Only what was needed for the tables above got loaded, so these are
+	// only errors that actually affected the output.
+	if (xr_instance_err) printf("XrInstance error: [%s]\n", xr_instance_err);
+	if (xr_system_err)   printf("XrSystemId error: [%s]\n", xr_system_err);
+	if (xr_session_err)  printf("XrSession error: [%s]\n", xr_session_err);
+	for (size_t i = 0; i < xr_tables.count; i++) {
+		if (xr_tables[i].name_func && strcmp(xr_tables[i].name_func, "xrCreateInstance") == 0)
+			printf("xrCreateInstance rejected %d extension(s), see -xrCreateInstance\n", (int32_t)xr_tables[i].cols[0].count - 1);
+	}
+
+	if (show_timings)
+		cli_print_timings();
+
 	openxr_info_release();
-	skg_shutdown();
+	if (cli_graphics_ready)
+		skg_shutdown();
+}
+
+///////////////////////////////////////////
+
+bool cli_init_graphics() {
+	if (cli_graphics_ready) return true;
+
+	cli_graphics_ready = skg_init("OpenXR Explorer", nullptr);
+	if (!cli_graphics_ready)
+		printf("Failed to init skg!\n");
+	return cli_graphics_ready;
+}
+
+///////////////////////////////////////////
+
+void cli_print_timings() {
+	// Anything that never happened shows as 0, so it's easy to see what
+	// the requested tables actually needed.
+	printf("Startup timings (ms):\n");
+	printf("	loader   %8.2f\n", stm_ms(xr_timings.loader));
+	printf("	skg      %8.2f\n", stm_ms(xr_timings.graphics));
+	printf("	instance %8.2f\n", stm_ms(xr_timings.instance));
+	printf("	system   %8.2f\n", stm_ms(xr_timings.system));
+	printf("	session  %8.2f\n", stm_ms(xr_timings.session));
+	printf("	total    %8.2f\n", stm_ms(stm_now()));
+
+	paths_stats_t paths = paths_stats();
+	printf("XrPath cache: %d paths, %llu hits, %llu misses, %zu string bytes\n",
+		paths.count, (unsigned long long)paths.hits, (unsigned long long)paths.misses, paths.string_bytes);
 }
 
 ///////////////////////////////////////////
@@ -75,26 +230,124 @@ Notes:	This tool shows a list of values provided from the active OpenXR
 
 Options:
 	-help	Show this help information!
+	-capture [file]
+		Save everything queried from the runtime to a
+		snapshot file, for use with the xrstubruntime
+		replay runtime. Snapshots also record the order
+		and timing of every call, see -trace.
+	-replay [file]
+		Use the xrstubruntime to answer everything from
+		a captured snapshot instead of the active
+		runtime. Combine with the options below.
+	-trace [file]
+		List the OpenXR calls recorded in a snapshot
+		file, in the order they were made.
+	-describe [name]
+		Show what the offline spec index has for a
+		struct, enum, value, function or extension.
+		Partial names list everything that matches.
+	-serial	Query the runtime from a single thread, for
+		runtimes that misbehave with parallel calls.
+	-session
+		Create an XrSession, for the tables that need
+		one, such as swapchain formats and
+		-RenderThroughput.
+	-metrics [hz] [seconds]
+		Sample every XR_META_performance_metrics counter
+		at the given rate, and stream them out as CSV.
+		0 seconds keeps going until stopped.
+	-events [seconds]
+		Begin a session and run frames for the given
+		time, printing every event as a line of JSON,
+		then how long each session state took to show
+		up.
+	-[live test] [seconds]
+		Run one of the live tests listed below, on a
+		running session. How the duration is used is
+		up to the test.
+	-csv	Print tables as comma separated values, with
+		their header rows, for pasting into spreadsheets.
+	-timing	Show how long startup took, broken down into
+		loader, graphics, instance, system and session.
+		Only what the other options needed gets loaded.
+	-[XrFormFactor or XrViewConfigurationType]
+		Only show tables for a particular form factor or
+		view configuration, by name, such as
+		-XR_FORM_FACTOR_HANDHELD_DISPLAY. Without one,
+		tables show for every system and view
+		configuration the runtime has.
 
 )_");
+	// Names only, so help never has to start up the runtime
+	array_t<const char *> funcs = {};
+	array_t<const char *> types = {};
+	openxr_table_names(&funcs, &types);
 	printf("	FUNCTIONS\n");
-	for (size_t i = 0; i < xr_tables.count; i++) {
-		if (xr_tables[i].name_func)
-			printf("	-%s\n", xr_tables[i].name_func);
-	}
+	for (size_t i = 0; i < funcs.count; i++)
+		printf("	-%s\n", funcs[i]);
 	printf("\n	TYPES\n");
-	for (size_t i = 0; i < xr_tables.count; i++) {
-		if (xr_tables[i].name_type)
-			printf("	-%s\n", xr_tables[i].name_type);
+	for (size_t i = 0; i < types.count; i++)
+		printf("	-%s\n", types[i]);
+	funcs.free();
+	types.free();
+	printf("\n	LIVE TESTS\n");
+	for (int32_t i = 0; i < live_test_count(); i++)
+		printf("	-%s [%g]\n		%s\n", live_test_get(i)->name, live_test_get(i)->default_duration, live_test_get(i)->description);
+}
+
+///////////////////////////////////////////
+
+display_table_t *cli_find_table(const char *name) {
+	// Tables only get loaded as needed, so keep loading until the name
+	// shows up, or there's nothing left to load.
+	display_table_t *table = nullptr;
+	do {
+		for (size_t c = 0; c < xr_tables.count; c++) {
+			if (cli_table_is(&xr_tables[c], name)) {
+				table = &xr_tables[c];
+				break;
+			}
+		}
+	} while (table == nullptr && openxr_load_next());
+
+	// Loading can shuffle tables around, so look it up again afterwards
+	if (table != nullptr && table->pending) {
+		table->requested = true;
+		openxr_load_requested();
+		return cli_find_table(name);
 	}
+	return table;
+}
+
+///////////////////////////////////////////
+
+bool cli_table_is(const display_table_t *table, const char *name) {
+	return
+		(table->name_func && strcmp_nocase(table->name_func, name) == 0) ||
+		(table->name_type && strcmp_nocase(table->name_type, name) == 0);
 }
 
 ///////////////////////////////////////////
 
 void cli_print_table(const display_table_t *table) {
-	printf("%s\n", table->show_type ? table->name_type : table->name_func);
+	// Tables that come once per system or view configuration say which
+	printf("%s", table->show_type ? table->name_type : table->name_func);
+	for (size_t i = 0; i < xr_systems.count; i++) {
+		if (xr_systems[i].form == table->form && table->form != 0)
+			printf(" - %s", xr_systems[i].name);
+	}
+	for (size_t i = 0; i < xr_view.configs.count; i++) {
+		if (xr_view.configs[i].form == table->form && xr_view.configs[i].type == table->view_config && table->view_config != 0)
+			printf(" - %s", xr_view.configs[i].name);
+	}
+	printf("\n");
 
-	size_t max[3] = {};
+	if (cli_csv) {
+		cli_print_csv(table);
+		return;
+	}
+
+	size_t max[sizeof(table->cols)/sizeof(table->cols[0])] = {};
 	for (size_t i = table->header_row?1:0; i < table->cols[0].count; i++) {
 		for (size_t c = 0; c < table->column_count; c++) {
 			size_t len = table->cols[c][i].text ? strlen(table->cols[c][i].text) : 0;
@@ -106,7 +359,9 @@ void cli_print_table(const display_table_t *table) {
 	for (size_t i = table->header_row ? 1 : 0; i < table->cols[0].count; i++) {
 		printf("| ");
 		for (size_t c = 0; c < table->column_count; c++) {
-			printf("%-*s", (int32_t)max[c], table->cols[c][i].text ? table->cols[c][i].text : "");
+			// Numbers line up on the right, so their digits do too
+			int32_t width = table->col_types[c] == record_type_number ? (int32_t)max[c] : -(int32_t)max[c];
+			printf("%*s", width, table->cols[c][i].text ? table->cols[c][i].text : "");
 			if (c != table->column_count-1)
 				printf(" | ");
 		}
@@ -116,6 +371,269 @@ void cli_print_table(const display_table_t *table) {
 
 ///////////////////////////////////////////
 
+void cli_print_csv(const display_table_t *table) {
+	// Unlike the padded tables, headers are kept, so spreadsheets know what
+	// each column is.
+	for (size_t i = 0; i < table->cols[0].count; i++) {
+		for (size_t c = 0; c < table->column_count; c++) {
+			const char *text = table->cols[c][i].text ? table->cols[c][i].text : "";
+			if (strpbrk(text, ",\"\n") == nullptr) {
+				printf("%s", text);
+			} else {
+				printf("\"");
+				for (const char *ch = text; *ch; ch++) {
+					if (*ch == '"') printf("\"\"");
+					else            printf("%c", *ch);
+				}
+				printf("\"");
+			}
+			if (c != table->column_count-1)
+				printf(",");
+		}
+		printf("\n");
+	}
+	printf("\n");
+}
+
+///////////////////////////////////////////
+
+void cli_stream_metrics(float rate_hz, float duration_sec) {
+	const display_table_t *paths = cli_find_table("xrEnumeratePerformanceMetricsCounterPathsMETA");
+	if (paths == nullptr || paths->error) {
+		printf("No performance metrics: %s\n", paths ? paths->error : "N/A");
+		return;
+	}
+
+	array_t<const char *> names = {};
+	for (size_t i = 0; i < paths->cols[0].count; i++)
+		names.add(paths->cols[0][i].text);
+	XrResult result = metrics_start(names.data, (int32_t)names.count, rate_hz);
+	names.free();
+	if (XR_FAILED(result)) {
+		printf("Couldn't start sampling: %s\n", openxr_result_string(result));
+		return;
+	}
+
+	printf("time_s");
+	for (int32_t i = 0; i < metrics_counter_count(); i++)
+		printf(",%s", metrics_counter_name(i));
+	printf("\n");
+
+	// Samples are pulled from the ring buffers in batches, so printing
+	// never holds up the sampler. A duration of 0 runs until killed.
+	float   *values = (float *)malloc(sizeof(float) * (metrics_counter_count() > 0 ? metrics_counter_count() : 1));
+	uint64_t next   = 0;
+	auto     start  = std::chrono::steady_clock::now();
+	while (duration_sec <= 0 || std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count() < duration_sec) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+		uint64_t written = metrics_sample_count();
+		for (; next < written; next++) {
+			double time;
+			if (!metrics_read(next, &time, values)) {
+				printf("# dropped sample %llu\n", (unsigned long long)next);
+				continue;
+			}
+			printf("%.4f", time);
+			for (int32_t i = 0; i < metrics_counter_count(); i++)
+				printf(",%g", values[i]);
+			printf("\n");
+		}
+		fflush(stdout);
+	}
+	free(values);
+	metrics_stop();
+}
+
+///////////////////////////////////////////
+
+void cli_run_live_test(int32_t test, float duration_sec) {
+	const char *err = live_test_start(test, duration_sec);
+	if (err) {
+		printf("Couldn't start %s: %s\n", live_test_get(test)->name, err);
+		return;
+	}
+	while (live_test_running())
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	const display_table_t *table = live_test_collect();
+	if (table == nullptr) return;
+	cli_print_table(table);
+	if (table->error)
+		printf("%s error: [%s]\n", table->name_type, table->error);
+}
+
+///////////////////////////////////////////
+
+void cli_stream_events(float duration_sec) {
+	// A session that isn't doing anything doesn't have much to say, so
+	// events get printed while the SessionLifecycle test runs it.
+	const char *err = live_test_start(cli_find_live_test("SessionLifecycle"), duration_sec);
+	if (err) {
+		printf("{\"error\":");
+		cli_print_json_string(err);
+		printf("}\n");
+		return;
+	}
+
+	auto print_events = []() {
+		xr_event_t event;
+		while (events_pop(&event)) {
+			printf("{\"time_s\":%.6f,\"event\":", event.time);
+			cli_print_json_string(events_type_name(event.type));
+			if (event.xr_time != 0)
+				printf(",\"xr_time\":%lld", (long long)event.xr_time);
+			if (event.type == XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED) {
+				printf(",\"state\":");
+				cli_print_json_string(events_state_name(event.state));
+			} else if (event.detail[0] != '\0') {
+				printf(",\"detail\":");
+				cli_print_json_string(event.detail);
+			}
+			printf("}\n");
+		}
+		fflush(stdout);
+	};
+	while (live_test_running()) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		print_events();
+	}
+	print_events();
+
+	const display_table_t *table = live_test_collect();
+	if (table == nullptr) return;
+	if (table->error) {
+		printf("{\"error\":");
+		cli_print_json_string(table->error);
+		printf("}\n");
+		return;
+	}
+	for (size_t i = 1; i < table->cols[0].count; i++) {
+		printf("{\"step\":");
+		cli_print_json_string(table->cols[0][i].text);
+		printf(",\"since_create_ms\":");
+		cli_print_json_value(table->cols[1][i].text);
+		printf(",\"since_previous_ms\":");
+		cli_print_json_value(table->cols[2][i].text);
+		printf("}\n");
+	}
+	if (events_dropped() > 0)
+		printf("{\"dropped\":%llu}\n", (unsigned long long)events_dropped());
+}
+
+///////////////////////////////////////////
+
+void cli_print_json_value(const char *text) {
+	// Numbers go out as numbers, anything else as a string, and nothing at
+	// all as null.
+	if (text == nullptr || text[0] == '\0' || strcmp(text, "Never") == 0) {
+		printf("null");
+		return;
+	}
+	char *end = nullptr;
+	strtod(text, &end);
+	if (*end == '\0') printf("%s", text);
+	else              cli_print_json_string(text);
+}
+
+///////////////////////////////////////////
+
+void cli_print_json_string(const char *text) {
+	// Runtime strings and result names can have anything in them
+	putchar('"');
+	for (const char *c = text ? text : ""; *c; c++) {
+		switch (*c) {
+		case '"':  printf("\\\""); break;
+		case '\\': printf("\\\\"); break;
+		case '\n': printf("\\n");  break;
+		case '\r': printf("\\r");  break;
+		case '\t': printf("\\t");  break;
+		default:
+			if ((unsigned char)*c < 0x20) printf("\\u%04x", (unsigned char)*c);
+			else                          putchar(*c);
+		}
+	}
+	putchar('"');
+}
+
+///////////////////////////////////////////
+
+int32_t cli_find_live_test(const char *name) {
+	for (int32_t i = 0; i < live_test_count(); i++) {
+		if (strcmp_nocase(live_test_get(i)->name, name) == 0) return i;
+	}
+	return -1;
+}
+
+///////////////////////////////////////////
+
+bool cli_pick_enum(const char *name, xr_settings_t *ref_settings) {
+	// Without settings, this just checks whether it's a name we know
+	xr_settings_t unused = {};
+	if (ref_settings == nullptr) ref_settings = &unused;
+	return
+		enums_value(name, &ref_settings->form) ||
+		enums_value(name, &ref_settings->view_config);
+}
+
+///////////////////////////////////////////
+
+void cli_print_trace(const char *file) {
+	snapshot_t trace = {};
+	if (!snapshot_load(file, &trace)) {
+		printf("Couldn't load snapshot %s!\n", file);
+		return;
+	}
+
+	printf("%s\n", file);
+	printf("| %5s | %10s | %-45s | %-18s | %-32s | %5s |\n", "#", "Time (ms)", "Function", "Key", "Result", "Items");
+	for (int32_t i = 0; i < trace.record_count; i++) {
+		const snapshot_record_t *record = &trace.records[i];
+		printf("| %5d | %10.3f | %-45s | 0x%016llx | %-32s | %5u |\n",
+			i,
+			record->time_ns / 1000000.0,
+			record->func,
+			(unsigned long long)record->key,
+			openxr_result_string((XrResult)record->result),
+			record->item_count);
+	}
+	snapshot_free(&trace);
+}
+
+///////////////////////////////////////////
+
+void cli_describe(const char *name) {
+	if (!spec_load()) {
+		printf("No offline spec index (%s) was found, try https://www.khronos.org/registry/OpenXR/specs/1.0/html/xrspec.html#%s\n", spec_file_name, name);
+		return;
+	}
+
+	spec_entry_t entry = {};
+	if (spec_find(name, &entry)) {
+		printf("%s (%s)\n\n%s\n\n", entry.name, spec_kind_name(entry.kind), entry.text);
+		return;
+	}
+
+	// Not a whole name, so list what it might have meant
+	const int32_t max_results = 50;
+	int32_t       results[max_results];
+	int32_t       count = spec_search(name, results, max_results);
+	if (count == 0) {
+		printf("Nothing in the spec index matches %s\n", name);
+		return;
+	}
+	printf("%s isn't in the spec index, did you mean:\n", name);
+	for (int32_t i = 0; i < count; i++) {
+		spec_entry_t match = spec_get(results[i]);
+		printf("	%-64s %s\n", match.name, spec_kind_name(match.kind));
+	}
+	if (count == max_results)
+		printf("	...\n");
+	printf("\n");
+}
+
+///////////////////////////////////////////
+
 int32_t strcmp_nocase(char const *a, char const *b) {
 	for (;; a++, b++) {
 		int d = tolower((unsigned char)*a) - tolower((unsigned char)*b);
@@ -42,6 +42,9 @@ void shell_loop(void (*step)());
 
 //int WinMain(HINSTANCE, HINSTANCE, LPSTR, int) {
 int main(int arg_count, const char **args) {
+	// Up front, so startup timings include everything
+	stm_setup();
+
 	if (!app_args(arg_count, args))
 		return 0;
 
@@ -53,8 +56,6 @@ int main(int arg_count, const char **args) {
 	if (!app_init())
 		return 2;
 
-	stm_setup();
-
 	shell_loop([]() {
 		// Start the Dear ImGui frame
 		skg_draw_begin();
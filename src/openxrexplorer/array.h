@@ -302,11 +302,10 @@ void array_t<T>::free() {
 
 template <typename T>
 array_t<T> array_t<T>::copy() const { 
-	array_t<T> result = { 
-		ARRAY_MALLOC(sizeof(T) * capacity), 
-		count, 
-		capacity 
-	}; 
+	array_t<T> result = {};
+	result.data     = (T*)ARRAY_MALLOC(sizeof(T) * capacity);
+	result.count    = count;
+	result.capacity = capacity;
 	ARRAY_MEMCPY(result.data, data, sizeof(T) * count); 
 	return result; 
 }
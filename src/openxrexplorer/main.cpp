@@ -3,11 +3,18 @@
 #include "imgui/imgui_internal.h"
 #include "xrruntime.h"
 #include "openxr_info.h"
+#include "openxr_bisect.h"
+#include "openxr_metrics.h"
+#include "openxr_live.h"
+#include "openxr_events.h"
+#include "openxr_spec.h"
 
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <math.h>
 
 /*** Global Variables ********************/
 
@@ -15,8 +22,14 @@ const char*   app_name        = "OpenXR Explorer";
 const char*   app_id          = "openxr-explorer";
 xr_settings_t app_xr_settings = {};
 
-runtime_t *runtimes      = nullptr;
-int32_t    runtime_count = 0;
+runtime_t       *runtimes        = nullptr;
+int32_t          runtime_count   = 0;
+int32_t          runtime_current = -1;
+// Picks up runtimes being installed or switched while we're open
+runtime_watch_t *runtime_watch   = nullptr;
+
+// Points into the spec index, which stays mapped for as long as we run
+spec_entry_t app_spec_entry = {};
 
 /*** Signatures **************************/
 
@@ -24,15 +37,34 @@ void app_window_openxr_functionality();
 void app_window_runtime();
 void app_window_view();
 void app_window_misc();
-void app_element_table(const display_table_t *table);
+void app_window_input();
+void app_window_metrics();
+void app_window_live();
+void app_window_events();
+void app_window_spec();
+void app_element_table(display_table_t *table);
+void app_element_plot (const display_table_t *table);
+void app_element_visibility(const xr_view_config_info_t *config);
 
 void app_set_runtime   (int32_t runtime_index);
+void app_reload_runtimes();
 void app_open_link     (const char *link);
 void app_open_spec     (const char *spec_item_name);
+void app_open_spec_link(const char *spec_anchor);
 
 /*** Code ********************************/
 
 bool app_args(int32_t arg_count, const char **args) {
+	// openxr_bisect_extensions runs copies of us to test extension sets
+	if (arg_count >= 2 && strcmp(args[1], "-probeinstance") == 0) {
+		exit(openxr_bisect_probe(arg_count - 2, args + 2));
+	}
+
+	// A replay on its own opens the snapshot in the GUI
+	if (arg_count == 3 && (strcmp(args[1], "-replay") == 0 || strcmp(args[1], "--replay") == 0)) {
+		return openxr_replay(args[2]);
+	}
+
 	if (arg_count > 1) {
 		app_cli(arg_count, args);
 		return false;
@@ -76,7 +108,8 @@ bool app_init() {
 	colors[ImGuiCol_TableRowBgAlt] = barely;
 	colors[ImGuiCol_TabUnfocusedActive] = colors[ImGuiCol_Separator] = midsat;
  
-	load_runtimes(runtime_config_path(), &runtimes, &runtime_count);
+	runtime_watch = runtime_watch_create(runtime_config_path());
+	app_reload_runtimes();
 
 	app_xr_settings.allow_session = false;
 	app_xr_settings.form          = XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY;
@@ -89,11 +122,23 @@ bool app_init() {
 
 void app_shutdown() {
 	openxr_info_release();
+	spec_unload();
+	runtime_watch_destroy(runtime_watch);
+	free(runtimes);
 }
 
 ///////////////////////////////////////////
 
 void app_step(ImVec2 canvas_size) {
+	// Tables that got opened last frame, and any test that just finished
+	openxr_load_requested();
+	live_test_collect();
+
+	// Only once things settle, installers touch a lot of files at once
+	int32_t runtime_changes = runtime_watch_poll(runtime_watch);
+	if (runtime_changes & runtime_change_list  ) app_reload_runtimes();
+	if (runtime_changes & runtime_change_active) openxr_info_reload(app_xr_settings);
+
 	ImGuiID dockspace_id = ImGui::DockSpaceOverViewport(0, NULL, ImGuiDockNodeFlags_PassthruCentralNode, NULL);
 	if (!ImGui::DockBuilderGetNode(dockspace_id)->IsSplitNode()) {
 		ImGuiID dock_id_left;
@@ -106,8 +151,13 @@ void app_step(ImVec2 canvas_size) {
 
 		ImGui::DockBuilderDockWindow("Runtime Information", dock_id_left);
 		ImGui::DockBuilderDockWindow("Misc Enumerations",   dock_id_right_bot);
+		ImGui::DockBuilderDockWindow("Input",               dock_id_right_bot);
 		ImGui::DockBuilderDockWindow("Extensions & Layers", dock_id_mid);
 		ImGui::DockBuilderDockWindow("View Configuration",  dock_id_right);
+		ImGui::DockBuilderDockWindow("Spec Reference",      dock_id_right);
+		ImGui::DockBuilderDockWindow("Performance Metrics", dock_id_right_bot);
+		ImGui::DockBuilderDockWindow("Live Tests",          dock_id_right_bot);
+		ImGui::DockBuilderDockWindow("Events",              dock_id_right_bot);
 		ImGui::DockBuilderFinish(dockspace_id);
 	}
 
@@ -115,15 +165,19 @@ void app_step(ImVec2 canvas_size) {
 	app_window_runtime();
 	app_window_view();
 	app_window_misc();
+	app_window_input();
+	app_window_metrics();
+	app_window_live();
+	app_window_events();
+	app_window_spec();
 	//ImGui::ShowDemoWindow();
 }
 
 ///////////////////////////////////////////
 
 void app_window_runtime() {
-	static int32_t current_runtime = -1;
-
-	ImGui::Begin("Runtime Information");
+	if (ImGui::Begin("Runtime Information"))
+		openxr_request_tag(display_tag_properties);
 
 	ImGui::Text("OpenXR Loader v%d.%d.%d", 
 		(int32_t)XR_VERSION_MAJOR(XR_CURRENT_API_VERSION),
@@ -138,14 +192,14 @@ void app_window_runtime() {
 
 	// Runtime picker
 	ImGui::PushItemWidth(-1);
-	if (ImGui::BeginCombo("##Change Runtime", current_runtime == -1 ? "Change Runtime" : runtimes[current_runtime].name)) {
+	if (ImGui::BeginCombo("##Change Runtime", runtime_current == -1 ? "Change Runtime" : runtimes[runtime_current].name)) {
 		for (int n = 0; n < runtime_count; n++) {
 			if (!runtimes[n].present) continue;
 
-			bool is_selected = (current_runtime == n);
-			if (ImGui::Selectable(runtimes[n].name, is_selected) && current_runtime != n) {
-				current_runtime = n;
-				app_set_runtime(current_runtime);
+			bool is_selected = (runtime_current == n);
+			if (ImGui::Selectable(runtimes[n].name, is_selected) && runtime_current != n) {
+				runtime_current = n;
+				app_set_runtime(runtime_current);
 			}
 			if (is_selected)
 				ImGui::SetItemDefaultFocus();
@@ -158,6 +212,10 @@ void app_window_runtime() {
 	}
 	ImGui::SameLine();
 	ImGui::Checkbox("Create XrSession", &app_xr_settings.allow_session);
+	ImGui::SameLine();
+	ImGui::Checkbox("Serial", &app_xr_settings.serial);
+	if (ImGui::IsItemHovered())
+		ImGui::SetTooltip("Query the runtime from a single thread, for runtimes that misbehave with parallel calls.");
 
 	ImGui::Spacing();
 	ImGui::Separator();
@@ -173,10 +231,7 @@ void app_window_runtime() {
 	}
 	ImGui::SameLine();
 	if (ImGui::Button("Reload list")) {
-		free(runtimes);
-		runtime_count = 0;
-		load_runtimes(runtime_config_path(), &runtimes, &runtime_count);
-		current_runtime = -1;
+		app_reload_runtimes();
 	}
 
 	ImGui::Spacing();
@@ -190,8 +245,31 @@ void app_window_runtime() {
 		ImGui::Separator();
 	}
 
+	// Every available system is already loaded, so no reload needed here.
+	// The requested form factor may not have been there, so stay in sync
+	// with what actually got loaded.
+	app_xr_settings.form = xr_settings.form;
+	const char *system_string = "N/A";
+	for (size_t i = 0; i < xr_systems.count; i++) {
+		if (xr_systems[i].form == app_xr_settings.form)
+			system_string = xr_systems[i].name;
+	}
+	if (xr_systems.count > 1 && ImGui::BeginCombo("Switch system", system_string)) {
+		for (int n = 0; n < xr_systems.count; n++) {
+			bool is_selected = (app_xr_settings.form == xr_systems[n].form);
+			if (ImGui::Selectable(xr_systems[n].name, is_selected)) {
+				app_xr_settings.form = xr_systems[n].form;
+				openxr_select_system(app_xr_settings.form);
+				app_xr_settings.view_config = xr_view.current_config;
+			}
+			if (is_selected)
+				ImGui::SetItemDefaultFocus();
+		}
+		ImGui::EndCombo();
+	}
+
 	for (size_t i = 0; i < xr_tables.count; i++) {
-		if (xr_tables[i].tag == display_tag_properties)
+		if (xr_tables[i].tag == display_tag_properties && openxr_table_current(&xr_tables[i]))
 			app_element_table(&xr_tables[i]);
 	}
 
@@ -201,7 +279,8 @@ void app_window_runtime() {
 ///////////////////////////////////////////
 
 void app_window_openxr_functionality() {
-	ImGui::Begin("Extensions & Layers");
+	if (ImGui::Begin("Extensions & Layers"))
+		openxr_request_tag(display_tag_features);
 
 	for (size_t i = 0; i < xr_tables.count; i++) {
 		if (xr_tables[i].tag == display_tag_features)
@@ -214,24 +293,28 @@ void app_window_openxr_functionality() {
 ///////////////////////////////////////////
 
 void app_window_view() {
-	ImGui::Begin("View Configuration");
+	if (ImGui::Begin("View Configuration"))
+		openxr_request_tag(display_tag_view);
 
 	const char *config_string = "N/A";
 	if (app_xr_settings.view_config == (XrViewConfigurationType)0)
 		app_xr_settings.view_config = xr_view.current_config;
-	for (size_t i = 0; i < xr_view.available_configs.count; i++) {
-		if (xr_view.available_configs[i] == app_xr_settings.view_config) {
-			config_string = xr_view.available_config_names[i];
+	for (size_t i = 0; i < xr_view.configs.count; i++) {
+		if (xr_view.configs[i].form == xr_settings.form && xr_view.configs[i].type == app_xr_settings.view_config) {
+			config_string = xr_view.configs[i].name;
 			break;
 		}
 	}
 
+	// Every configuration is already loaded, so no reload needed here
 	if (ImGui::BeginCombo("Switch view config", config_string)) {
-		for (int n = 0; n < xr_view.available_configs.count; n++) {
-			bool is_selected = (app_xr_settings.view_config == xr_view.available_configs[n]);
-			if (ImGui::Selectable(xr_view.available_config_names[n], is_selected)) {
-				app_xr_settings.view_config = xr_view.available_configs[n];
-				openxr_info_reload(app_xr_settings);
+		for (int n = 0; n < xr_view.configs.count; n++) {
+			if (xr_view.configs[n].form != xr_settings.form) continue;
+
+			bool is_selected = (app_xr_settings.view_config == xr_view.configs[n].type);
+			if (ImGui::Selectable(xr_view.configs[n].name, is_selected)) {
+				app_xr_settings.view_config = xr_view.configs[n].type;
+				openxr_select_view(app_xr_settings.view_config);
 			}
 			if (is_selected)
 				ImGui::SetItemDefaultFocus();
@@ -243,14 +326,70 @@ void app_window_view() {
 	ImGui::Separator();
 
 	for (size_t i = 0; i < xr_tables.count; i++) {
-		if (xr_tables[i].tag == display_tag_view)
+		if (xr_tables[i].tag == display_tag_view && openxr_table_current(&xr_tables[i]))
 			app_element_table(&xr_tables[i]);
 	}
+
+	for (size_t i = 0; i < xr_view.configs.count; i++) {
+		if (xr_view.configs[i].form == xr_settings.form && xr_view.configs[i].type == xr_view.current_config)
+			app_element_visibility(&xr_view.configs[i]);
+	}
 	ImGui::End();
 }
 
 ///////////////////////////////////////////
 
+void app_element_visibility(const xr_view_config_info_t *config) {
+	if (config->visibility_masks.count == 0) return;
+
+	ImGui::Spacing();
+	ImGui::Text("Visibility masks");
+
+	const ImU32 visible_col = IM_COL32(120, 43, 144, 255);
+	const ImU32 hidden_col  = IM_COL32( 20, 20,  20, 255);
+	const float preview_h   = 160 * app_scale;
+
+	for (size_t m = 0; m < config->visibility_masks.count; m++) {
+		const xr_visibility_mask_t *mask = &config->visibility_masks[m];
+		if (mask->hidden_fraction < 0 || mask->width == 0 || mask->height == 0) continue;
+
+		// Same bounds the rasterizer uses, the two meshes together cover
+		// the whole image.
+		ImVec2 min = {  INFINITY,  INFINITY };
+		ImVec2 max = { -INFINITY, -INFINITY };
+		for (size_t v = 0; v < mask->hidden_verts.count + mask->visible_verts.count; v++) {
+			XrVector2f pt = v < mask->hidden_verts.count ? mask->hidden_verts[v] : mask->visible_verts[v - mask->hidden_verts.count];
+			min = { fminf(min.x, pt.x), fminf(min.y, pt.y) };
+			max = { fmaxf(max.x, pt.x), fmaxf(max.y, pt.y) };
+		}
+
+		ImVec2 size  = { preview_h * mask->width / mask->height, preview_h };
+		ImVec2 start = ImGui::GetCursorScreenPos();
+		auto   to_px = [&](XrVector2f pt) { return ImVec2{
+			start.x + (pt.x  - min.x) / (max.x - min.x) * size.x,
+			start.y + (max.y - pt.y ) / (max.y - min.y) * size.y }; };
+
+		ImGui::BeginGroup();
+		ImDrawList *draw = ImGui::GetWindowDrawList();
+		bool use_hidden = mask->hidden_inds.count >= 3;
+		draw->AddRectFilled(start, { start.x + size.x, start.y + size.y }, use_hidden ? visible_col : hidden_col);
+
+		const array_t<XrVector2f> &verts = use_hidden ? mask->hidden_verts : mask->visible_verts;
+		const array_t<uint32_t>   &inds  = use_hidden ? mask->hidden_inds  : mask->visible_inds;
+		for (size_t i = 0; i + 2 < inds.count; i += 3) {
+			if (inds[i] >= verts.count || inds[i+1] >= verts.count || inds[i+2] >= verts.count) continue;
+			draw->AddTriangleFilled(to_px(verts[inds[i]]), to_px(verts[inds[i+1]]), to_px(verts[inds[i+2]]), use_hidden ? hidden_col : visible_col);
+		}
+		ImGui::Dummy(size);
+		ImGui::Text("View %u: %.1f%% hidden", mask->view, mask->hidden_fraction * 100);
+		ImGui::EndGroup();
+		ImGui::SameLine();
+	}
+	ImGui::NewLine();
+}
+
+///////////////////////////////////////////
+
 void app_window_misc() {
 	ImGui::Begin("Misc Enumerations");
 
@@ -264,7 +403,295 @@ void app_window_misc() {
 
 ///////////////////////////////////////////
 
-void app_element_table(const display_table_t *table) {
+void app_window_input() {
+	ImGui::Begin("Input");
+
+	for (size_t i = 0; i < xr_tables.count; i++) {
+		if (xr_tables[i].tag == display_tag_input)
+			app_element_table(&xr_tables[i]);
+	}
+
+	ImGui::End();
+}
+
+///////////////////////////////////////////
+
+void app_window_metrics() {
+	static array_t<bool> selected   = {};
+	static float         rate_hz    = 10;
+	static float         window_sec = 10;
+	static XrResult      start_err  = XR_SUCCESS;
+
+	if (!ImGui::Begin("Performance Metrics")) {
+		ImGui::End();
+		return;
+	}
+
+	// The counter list is a regular misc enum table
+	display_table_t *paths = nullptr;
+	for (size_t i = 0; i < xr_tables.count; i++) {
+		if (xr_tables[i].name_func && strcmp(xr_tables[i].name_func, "xrEnumeratePerformanceMetricsCounterPathsMETA") == 0)
+			paths = &xr_tables[i];
+	}
+
+	if (!metrics_running()) {
+		if (paths == nullptr) {
+			ImGui::Text("N/A");
+		} else if (paths->pending) {
+			paths->requested = true;
+			ImGui::Text("Loading...");
+		} else if (paths->error) {
+			ImGui::TextWrapped("%s", paths->error);
+		} else {
+			if (selected.count != paths->cols[0].count) {
+				selected.free();
+				selected = array_t<bool>::make_fill((int32_t)paths->cols[0].count, true);
+			}
+			for (size_t i = 0; i < paths->cols[0].count; i++)
+				ImGui::Checkbox(paths->cols[0][i].text, &selected[i]);
+
+			ImGui::SliderFloat("Sample rate (Hz)", &rate_hz, 1, 120, "%.0f");
+			if (ImGui::Button("Start sampling")) {
+				array_t<const char *> names = {};
+				for (size_t i = 0; i < selected.count; i++) {
+					if (selected[i]) names.add(paths->cols[0][i].text);
+				}
+				start_err = metrics_start(names.data, (int32_t)names.count, rate_hz);
+				names.free();
+			}
+			if (XR_FAILED(start_err))
+				ImGui::Text("Failed to start: %s", openxr_result_string(start_err));
+		}
+		ImGui::End();
+		return;
+	}
+
+	if (ImGui::Button("Stop sampling"))
+		metrics_stop();
+	ImGui::SameLine();
+	ImGui::SliderFloat("Window (s)", &window_sec, 1, 30, "%.0f");
+
+	static float history[4096];
+	for (int32_t i = 0; metrics_running() && i < metrics_counter_count(); i++) {
+		int32_t         count = metrics_history(i, window_sec, history, sizeof(history)/sizeof(history[0]));
+		metrics_stats_t stats = metrics_stats  (history, count);
+		const char     *unit  = metrics_counter_unit(i);
+
+		ImGui::Text("%s", metrics_counter_name(i));
+		char overlay[128];
+		snprintf(overlay, sizeof(overlay), "min %.2f%s  avg %.2f%s  max %.2f%s", stats.min, unit, stats.avg, unit, stats.max, unit);
+		ImGui::PushID(i);
+		ImGui::PlotLines("##plot", history, count, 0, overlay, stats.min, stats.max, ImVec2(-1, 60 * app_scale));
+		ImGui::PopID();
+	}
+
+	ImGui::End();
+}
+
+///////////////////////////////////////////
+
+void app_window_live() {
+	static array_t<float> durations = {};
+	static const char    *start_err = nullptr;
+
+	if (!ImGui::Begin("Live Tests")) {
+		ImGui::End();
+		return;
+	}
+
+	if (!xr_settings.allow_session) {
+		ImGui::TextWrapped("These run a session for real, so they need Create XrSession on, and a reload.");
+		ImGui::End();
+		return;
+	}
+
+	if (live_test_running()) {
+		ImGui::ProgressBar(live_test_progress());
+		if (ImGui::Button("Cancel"))
+			live_test_stop();
+	} else {
+		if (durations.count != live_test_count()) {
+			durations.clear();
+			for (int32_t i = 0; i < live_test_count(); i++)
+				durations.add(live_test_get(i)->default_duration);
+		}
+		for (int32_t i = 0; i < live_test_count(); i++) {
+			const live_test_t *test = live_test_get(i);
+			ImGui::PushID(i);
+			ImGui::Text("%s", test->name);
+			ImGui::TextWrapped("%s", test->description);
+			ImGui::SliderFloat("Duration (s)", &durations[i], 1, 30, "%.0f");
+			if (ImGui::Button("Run"))
+				start_err = live_test_start(i, durations[i]);
+			ImGui::PopID();
+			ImGui::Spacing();
+		}
+		if (start_err)
+			ImGui::Text("Failed to start: %s", start_err);
+	}
+
+	ImGui::Spacing();
+	ImGui::Separator();
+	ImGui::Spacing();
+
+	for (size_t i = 0; i < xr_tables.count; i++) {
+		if (xr_tables[i].tag == display_tag_live && openxr_table_current(&xr_tables[i])) {
+			app_element_table(&xr_tables[i]);
+			app_element_plot (&xr_tables[i]);
+		}
+	}
+
+	ImGui::End();
+}
+
+///////////////////////////////////////////
+
+void app_window_events() {
+	static array_t<xr_event_t> history     = {};
+	const  size_t              max_history = 1000;
+
+	// Drained whether the window is open or not, so the queue never fills
+	xr_event_t event;
+	while (events_pop(&event)) {
+		if (history.count >= max_history) history.remove(0);
+		history.add(event);
+	}
+
+	if (!ImGui::Begin("Events")) {
+		ImGui::End();
+		return;
+	}
+
+	ImGui::AlignTextToFramePadding();
+	ImGui::Text("Session state: %s", xr_session ? events_state_name(events_session_state()) : "No XrSession");
+	if (events_dropped() > 0) {
+		ImGui::SameLine();
+		ImGui::Text("(%llu dropped)", (unsigned long long)events_dropped());
+	}
+	ImGui::SameLine(ImGui::GetContentRegionMax().x - (ImGui::CalcTextSize("Clear").x + GImGui->Style.FramePadding.x * 3));
+	if (ImGui::Button("Clear"))
+		history.clear();
+	ImGui::TextWrapped("Nothing happens to a session until it's begun, the SessionLifecycle live test does that, and times each step.");
+
+	ImGuiTableFlags flags = ImGuiTableFlags_BordersV | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY;
+	if (ImGui::BeginTable("Event Stream", 4, flags)) {
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn("Time (s)", ImGuiTableColumnFlags_WidthFixed, ImGui::CalcTextSize("000.0000").x);
+		ImGui::TableSetupColumn("Event");
+		ImGui::TableSetupColumn("Detail");
+		ImGui::TableSetupColumn("XrTime", ImGuiTableColumnFlags_WidthFixed, ImGui::CalcTextSize("0000000000000000").x);
+		ImGui::TableHeadersRow();
+
+		for (size_t i = 0; i < history.count; i++) {
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn(); ImGui::Text("%.4f", history[i].time);
+			ImGui::TableNextColumn(); ImGui::Text("%s",   events_type_name(history[i].type));
+			ImGui::TableNextColumn(); ImGui::Text("%s",   history[i].detail);
+			ImGui::TableNextColumn(); if (history[i].xr_time != 0) ImGui::Text("%lld", (long long)history[i].xr_time);
+		}
+		// Follow new events, unless scrolled up to look at old ones
+		if (ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+			ImGui::SetScrollHereY(1.0f);
+		ImGui::EndTable();
+	}
+
+	ImGui::End();
+}
+
+///////////////////////////////////////////
+
+void app_window_spec() {
+	static char    query[128]   = {};
+	static int32_t results[100] = {};
+	static int32_t result_count = 0;
+
+	if (!ImGui::Begin("Spec Reference")) {
+		ImGui::End();
+		return;
+	}
+
+	if (!spec_load()) {
+		ImGui::TextWrapped("No offline spec index was found, so spec links open the online spec instead. The index is built from the OpenXR registry along with openxr-explorer, as %s.", spec_file_name);
+		ImGui::End();
+		return;
+	}
+
+	// A search is a binary search and a scan of a few thousand names, which
+	// is quick enough to redo on every keystroke.
+	ImGui::PushItemWidth(-1);
+	if (ImGui::InputTextWithHint("##Search", "Search structs, enums, functions and extensions", query, sizeof(query)))
+		result_count = query[0] ? spec_search(query, results, sizeof(results)/sizeof(results[0])) : 0;
+	ImGui::PopItemWidth();
+
+	if (result_count > 0) {
+		ImGui::BeginChild("Results", ImVec2(0, ImGui::GetTextLineHeightWithSpacing() * 8), true);
+		for (int32_t i = 0; i < result_count; i++) {
+			spec_entry_t entry = spec_get(results[i]);
+			ImGui::PushID(i);
+			if (ImGui::Selectable(entry.name, entry.name == app_spec_entry.name))
+				app_spec_entry = entry;
+			ImGui::SameLine(ImGui::GetContentRegionMax().x - ImGui::CalcTextSize(spec_kind_name(entry.kind)).x);
+			ImGui::TextDisabled("%s", spec_kind_name(entry.kind));
+			ImGui::PopID();
+		}
+		ImGui::EndChild();
+	} else if (query[0]) {
+		ImGui::TextDisabled("Nothing matches");
+	}
+
+	if (app_spec_entry.name == nullptr) {
+		ImGui::TextWrapped("Spec buttons on the tables show their entry here, or search for one above.");
+		ImGui::End();
+		return;
+	}
+
+	ImGui::Spacing();
+	ImGui::Separator();
+	ImGui::Spacing();
+
+	ImGui::AlignTextToFramePadding();
+	ImGui::Text("%s", app_spec_entry.name);
+	ImGui::SameLine();
+	ImGui::TextDisabled("%s", spec_kind_name(app_spec_entry.kind));
+	ImGui::SameLine(ImGui::GetContentRegionMax().x - (ImGui::CalcTextSize("Open Online").x + GImGui->Style.FramePadding.x * 3));
+	if (ImGui::Button("Open Online"))
+		app_open_spec_link(app_spec_entry.anchor);
+
+	// Declarations are laid out like code, so they scroll rather than wrap
+	ImGui::BeginChild("Entry", ImVec2(0, 0), false, ImGuiWindowFlags_HorizontalScrollbar);
+	ImGui::TextUnformatted(app_spec_entry.text);
+	ImGui::EndChild();
+
+	ImGui::End();
+}
+
+///////////////////////////////////////////
+
+void app_reload_runtimes() {
+	// The list can shift around, so the selection is found again by its
+	// manifest rather than its index.
+	char selected_file[sizeof(runtimes[0].file)] = {};
+	if (runtime_current >= 0 && runtime_current < runtime_count)
+		snprintf(selected_file, sizeof(selected_file), "%s", runtimes[runtime_current].file);
+
+	free(runtimes);
+	runtimes        = nullptr;
+	runtime_count   = 0;
+	runtime_current = -1;
+	load_runtimes(runtime_config_path(), &runtimes, &runtime_count);
+	runtime_watch_list(runtime_watch, runtimes, runtime_count);
+
+	for (int32_t i = 0; selected_file[0] != '\0' && i < runtime_count; i++) {
+		if (runtimes[i].present && strcmp(runtimes[i].file, selected_file) == 0) {
+			runtime_current = i;
+			break;
+		}
+	}
+}
+
+///////////////////////////////////////////
+
+void app_element_table(display_table_t *table) {
 	const float  text_col = 0.7f;
 	const ImVec4 text_vec = ImVec4{ text_col,text_col,text_col,1 };
 
@@ -287,7 +714,13 @@ void app_element_table(const display_table_t *table) {
 
 		ImGuiTableFlags_ flags = ImGuiTableFlags_BordersV;
 		if (table->column_count > 2) flags = (ImGuiTableFlags_)(flags | ImGuiTableFlags_RowBg);
-		if (table->error) {
+		if (table->pending) {
+			// Opened for the first time, app_step loads it next frame
+			table->requested = true;
+			ImGui::PushStyleColor(ImGuiCol_Text, text_vec);
+			ImGui::Text("Loading...");
+			ImGui::PopStyleColor();
+		} else if (table->error) {
 			if (ImGui::BeginTable(table->name_type, 1, flags)) {
 				ImGui::TableNextRow();
 				ImGui::TableNextColumn();
@@ -320,6 +753,10 @@ void app_element_table(const display_table_t *table) {
 						ImGui::PushStyleColor(ImGuiCol_Text, text_vec);
 						ImGui::PopID();
 					} else {
+						if (table->col_types[c] == record_type_number) {
+							float offset = ImGui::GetContentRegionAvail().x - ImGui::CalcTextSize(table->cols[c][i].text).x;
+							if (offset > 0) ImGui::SetCursorPosX(ImGui::GetCursorPosX() + offset);
+						}
 						ImGui::Text("%s", table->cols[c][i].text);
 					}
 				}
@@ -347,6 +784,42 @@ void app_element_table(const display_table_t *table) {
 
 ///////////////////////////////////////////
 
+void app_element_plot(const display_table_t *table) {
+	if (table->error || !table->header_row || table->cols[0].count < 2) return;
+
+	const live_test_t *test = nullptr;
+	for (int32_t i = 0; i < live_test_count(); i++) {
+		if (strcmp(live_test_get(i)->name, table->name_type) == 0)
+			test = live_test_get(i);
+	}
+	if (test == nullptr || test->plot_columns == 0) return;
+
+	// One line per column, from the first row to the last
+	static array_t<float> values = {};
+	ImGui::PushID(table->name_type);
+	for (int32_t c = 0; c < table->column_count; c++) {
+		if ((test->plot_columns & (1 << c)) == 0) continue;
+
+		values.clear();
+		float min = 0, max = 0;
+		for (size_t i = 1; i < table->cols[c].count; i++) {
+			const char *first = table->cols[0][i].text;
+			if (first == nullptr || first[0] < '0' || first[0] > '9') continue;
+			float value = (float)atof(table->cols[c][i].text);
+			if (value > max) max = value;
+			values.add(value);
+		}
+		char overlay[128];
+		snprintf(overlay, sizeof(overlay), "%s, max %.1f", table->cols[c][0].text, max);
+		ImGui::PushID(c);
+		ImGui::PlotLines("##plot", values.data, (int)values.count, 0, overlay, min, max * 1.1f, ImVec2(-1, 60 * app_scale));
+		ImGui::PopID();
+	}
+	ImGui::PopID();
+}
+
+///////////////////////////////////////////
+
 #if defined(_WIN32)
 
 #define WIN32_LEAN_AND_MEAN
@@ -372,6 +845,8 @@ void app_set_runtime(int32_t runtime_index) {
 		WaitForSingleObject(info.hProcess, INFINITE);
 		CloseHandle(info.hProcess);
 
+		// We already know about this change, no need to hear it again
+		runtime_watch_clear(runtime_watch);
 		openxr_info_reload(app_xr_settings);
 	}
 }
@@ -391,6 +866,7 @@ void app_set_runtime(int32_t runtime_index) {
 		snprintf(command, sizeof(command), "sudo xrsetruntime -%s", runtimes[runtime_index].name);
 	}
 	system(command);
+	runtime_watch_clear(runtime_watch);
 	openxr_info_reload(app_xr_settings);
 }
 
@@ -412,7 +888,21 @@ void app_open_link(const char *link) {
 ///////////////////////////////////////////
 
 void app_open_spec(const char *spec_item_name) {
+	// The offline index needs no browser or network, so it comes first,
+	// and the online spec is only for things it doesn't have.
+	spec_entry_t entry = {};
+	if (spec_find(spec_item_name, &entry)) {
+		app_spec_entry = entry;
+		ImGui::SetWindowFocus("Spec Reference");
+		return;
+	}
+	app_open_spec_link(spec_item_name);
+}
+
+///////////////////////////////////////////
+
+void app_open_spec_link(const char *spec_anchor) {
 	char buffer[1024];
-	snprintf(buffer, sizeof(buffer), "https://www.khronos.org/registry/OpenXR/specs/1.0/html/xrspec.html#%s", spec_item_name);
+	snprintf(buffer, sizeof(buffer), "https://www.khronos.org/registry/OpenXR/specs/1.0/html/xrspec.html#%s", spec_anchor);
 	app_open_link(buffer);
 }
\ No newline at end of file
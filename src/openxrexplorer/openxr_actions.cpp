@@ -0,0 +1,322 @@
+#include "openxr_actions.h"
+#include "openxr_info.h"
+#include "openxr_live.h"
+#include "openxr_paths.h"
+#include "openxr_records.h"
+#include "xrsnapshot.h"
+
+#include <stdio.h>
+
+#include <chrono>
+
+/*** Types *******************************/
+
+enum actions_type_ {
+	actions_type_bool,
+	actions_type_float,
+	actions_type_vec2,
+	actions_type_pose,
+	actions_type_haptic,
+	actions_type_max,
+};
+
+struct actions_profile_t {
+	const char *path;
+	const char *users [2];
+	// One input or output per action type, nullptr if the profile doesn't
+	// have anything that fits.
+	const char *inputs[actions_type_max];
+};
+
+struct actions_level_t {
+	XrActionSet       set;
+	array_t<XrAction> actions;
+	float             suggest_ms;
+	int32_t           accepted;
+};
+
+/*** Global Variables ********************/
+
+const XrActionType actions_types[actions_type_max] = {
+	XR_ACTION_TYPE_BOOLEAN_INPUT,
+	XR_ACTION_TYPE_FLOAT_INPUT,
+	XR_ACTION_TYPE_VECTOR2F_INPUT,
+	XR_ACTION_TYPE_POSE_INPUT,
+	XR_ACTION_TYPE_VIBRATION_OUTPUT,
+};
+const char *actions_type_names[actions_type_max] = { "bool", "float", "vec2", "pose", "haptic" };
+
+const actions_profile_t actions_profiles[] = {
+	{ "/interaction_profiles/khr/simple_controller",      { "/user/hand/left", "/user/hand/right" }, { "/input/select/click",     nullptr,                    nullptr,                  "/input/grip/pose", "/output/haptic"      } },
+	{ "/interaction_profiles/google/daydream_controller", { "/user/hand/left", "/user/hand/right" }, { "/input/select/click",     nullptr,                    "/input/trackpad",        "/input/grip/pose", nullptr               } },
+	{ "/interaction_profiles/htc/vive_controller",        { "/user/hand/left", "/user/hand/right" }, { "/input/trigger/click",    "/input/trigger/value",     "/input/trackpad",        "/input/grip/pose", "/output/haptic"      } },
+	{ "/interaction_profiles/htc/vive_pro",               { "/user/head",      nullptr            }, { "/input/system/click",     nullptr,                    nullptr,                  nullptr,            nullptr               } },
+	{ "/interaction_profiles/microsoft/motion_controller",{ "/user/hand/left", "/user/hand/right" }, { "/input/squeeze/click",    "/input/trigger/value",     "/input/thumbstick",      "/input/grip/pose", "/output/haptic"      } },
+	{ "/interaction_profiles/microsoft/xbox_controller",  { "/user/gamepad",   nullptr            }, { "/input/a/click",          "/input/trigger_left/value","/input/thumbstick_left", nullptr,            "/output/haptic_left" } },
+	{ "/interaction_profiles/oculus/go_controller",       { "/user/hand/left", "/user/hand/right" }, { "/input/trigger/click",    nullptr,                    "/input/trackpad",        "/input/grip/pose", nullptr               } },
+	{ "/interaction_profiles/oculus/touch_controller",    { "/user/hand/left", "/user/hand/right" }, { "/input/thumbstick/click", "/input/trigger/value",     "/input/thumbstick",      "/input/grip/pose", "/output/haptic"      } },
+	{ "/interaction_profiles/valve/index_controller",     { "/user/hand/left", "/user/hand/right" }, { "/input/trigger/click",    "/input/trigger/value",     "/input/thumbstick",      "/input/grip/pose", "/output/haptic"      } },
+};
+const int32_t actions_profile_count = sizeof(actions_profiles) / sizeof(actions_profiles[0]);
+
+// Actions of each type in each benchmark set
+const int32_t actions_levels[]     = { 1, 2, 4, 8, 16, 32, 64 };
+const int32_t actions_level_count  = sizeof(actions_levels) / sizeof(actions_levels[0]);
+
+// The probe's set lives as long as the instance, since the suggested
+// bindings it leaves behind still point at it.
+XrActionSet     actions_profile_set     = XR_NULL_HANDLE;
+XrResult        actions_profile_result  = XR_ERROR_VALIDATION_FAILURE;
+XrResult        actions_profile_results [actions_profile_count] = {};
+int32_t         actions_profile_bindings[actions_profile_count] = {};
+
+actions_level_t actions_sets[actions_level_count] = {};
+bool            actions_attached        = false;
+float           actions_attach_ms       = 0;
+float           actions_suggest_all_ms  = 0;
+int32_t         actions_suggest_all_ok  = 0;
+
+/*** Signatures **************************/
+
+XrResult actions_create_set(const char *name, int32_t per_type, XrActionSet *out_set, array_t<XrAction> *out_actions);
+void     actions_bindings  (const actions_profile_t *profile, const XrAction *actions, int32_t per_type, array_t<XrActionSuggestedBinding> *ref_bindings);
+XrResult actions_suggest   (const actions_profile_t *profile, const array_t<XrActionSuggestedBinding> *bindings, float *out_ms);
+
+/*** Code ********************************/
+
+void actions_probe_profiles() {
+	array_t<XrAction> actions = {};
+	actions_profile_result = actions_create_set("explorer_profiles", 1, &actions_profile_set, &actions);
+	if (XR_FAILED(actions_profile_result)) {
+		actions.free();
+		return;
+	}
+
+	array_t<XrActionSuggestedBinding> bindings = {};
+	for (int32_t p = 0; p < actions_profile_count; p++) {
+		bindings.clear();
+		actions_bindings(&actions_profiles[p], actions.data, 1, &bindings);
+		actions_profile_results [p] = actions_suggest(&actions_profiles[p], &bindings, nullptr);
+		actions_profile_bindings[p] = (int32_t)bindings.count;
+		// Keyed by the path's text, since XrPath values differ between runs
+		openxr_capture("xrSuggestInteractionProfileBindings", snapshot_hash(actions_profiles[p].path), actions_profile_results[p], nullptr, 0, 0);
+	}
+
+	bindings.free();
+	actions .free();
+}
+
+///////////////////////////////////////////
+
+XrResult actions_load_profiles(xr_records_t *ref_records) {
+	// Without a probe to go on, asking now would only say the benchmark's
+	// sets are attached, so say that instead of rejecting every profile.
+	if (XR_FAILED(actions_profile_result))
+		return actions_attached ? XR_ERROR_ACTIONSETS_ALREADY_ATTACHED : actions_profile_result;
+
+	for (int32_t p = 0; p < actions_profile_count; p++) {
+		records_add_string(ref_records, actions_profiles[p].path);
+		records_add_enum  (ref_records, actions_profile_results [p]);
+		records_add_number(ref_records, (double)actions_profile_bindings[p]);
+	}
+	return XR_SUCCESS;
+}
+
+///////////////////////////////////////////
+
+void actions_release_profiles() {
+	// Destroying the instance takes the set along with it
+	actions_profile_set    = XR_NULL_HANDLE;
+	actions_profile_result = XR_ERROR_VALIDATION_FAILURE;
+}
+
+///////////////////////////////////////////
+
+const char *actions_benchmark(float duration_sec, array_t<const char *> *ref_items) {
+	typedef std::chrono::steady_clock clock;
+
+	XrResult result = XR_SUCCESS;
+	if (!actions_attached) {
+		actions_release();
+		for (int32_t l = 0; l < actions_level_count; l++) {
+			char name[32];
+			snprintf(name, sizeof(name), "explorer_probe_%d", actions_levels[l]);
+			result = actions_create_set(name, actions_levels[l], &actions_sets[l].set, &actions_sets[l].actions);
+			if (XR_FAILED(result)) {
+				actions_release();
+				return openxr_result_string(result);
+			}
+		}
+
+		// Each suggestion replaces the last one for that profile, so these
+		// are each timed on their own, and then everything goes in together
+		// for the attach.
+		array_t<XrActionSuggestedBinding> bindings = {};
+		for (int32_t l = 0; l < actions_level_count; l++) {
+			actions_level_t *level = &actions_sets[l];
+			for (int32_t p = 0; p < actions_profile_count; p++) {
+				bindings.clear();
+				actions_bindings(&actions_profiles[p], level->actions.data, actions_levels[l], &bindings);
+				float ms = 0;
+				if (XR_SUCCEEDED(actions_suggest(&actions_profiles[p], &bindings, &ms))) level->accepted++;
+				level->suggest_ms += ms;
+			}
+		}
+		for (int32_t p = 0; p < actions_profile_count; p++) {
+			bindings.clear();
+			for (int32_t l = 0; l < actions_level_count; l++)
+				actions_bindings(&actions_profiles[p], actions_sets[l].actions.data, actions_levels[l], &bindings);
+			float ms = 0;
+			if (XR_SUCCEEDED(actions_suggest(&actions_profiles[p], &bindings, &ms))) actions_suggest_all_ok++;
+			actions_suggest_all_ms += ms;
+		}
+		bindings.free();
+
+		XrActionSet sets[actions_level_count];
+		for (int32_t l = 0; l < actions_level_count; l++) sets[l] = actions_sets[l].set;
+		XrSessionActionSetsAttachInfo attach_info = { XR_TYPE_SESSION_ACTION_SETS_ATTACH_INFO };
+		attach_info.countActionSets = actions_level_count;
+		attach_info.actionSets      = sets;
+		clock::time_point start = clock::now();
+		result = xrAttachSessionActionSets(xr_session, &attach_info);
+		actions_attach_ms = std::chrono::duration<float, std::milli>(clock::now() - start).count();
+		if (XR_FAILED(result)) {
+			actions_release();
+			return openxr_result_string(result);
+		}
+		actions_attached = true;
+	}
+
+	// Syncing needs a running session, and only does much when focused
+	if (XR_FAILED(result = live_session_begin()))
+		return openxr_result_string(result);
+
+	ref_items->add("Actions per type");
+	ref_items->add("Total actions");
+	ref_items->add(new_string("Suggest (ms, %d profiles)", actions_profile_count));
+	ref_items->add("Attach (ms)");
+	ref_items->add("xrSyncActions p50/p99 (us)");
+	ref_items->add("Sync result");
+
+	array_t<float> sync_times = {};
+	float          level_sec  = duration_sec / actions_level_count;
+	for (int32_t l = 0; l < actions_level_count && !live_cancelled(); l++) {
+		XrActiveActionSet active = { actions_sets[l].set, XR_NULL_PATH };
+		XrActionsSyncInfo sync_info = { XR_TYPE_ACTIONS_SYNC_INFO };
+		sync_info.countActiveActionSets = 1;
+		sync_info.activeActionSets      = &active;
+
+		// Once a frame, like an app would
+		XrResult          sync_result = XR_SUCCESS;
+		clock::time_point start       = clock::now();
+		sync_times.clear();
+		while (std::chrono::duration<float>(clock::now() - start).count() < level_sec && !live_cancelled()) {
+			live_set_progress((l + std::chrono::duration<float>(clock::now() - start).count() / level_sec) / actions_level_count);
+
+			XrFrameState state = { XR_TYPE_FRAME_STATE };
+			if (XR_FAILED(result = live_frame_begin(&state))) break;
+			clock::time_point sync_start = clock::now();
+			XrResult synced = xrSyncActions(xr_session, &sync_info);
+			sync_times.add(std::chrono::duration<float, std::micro>(clock::now() - sync_start).count());
+			if (synced != XR_SUCCESS) sync_result = synced;
+			if (XR_FAILED(result = live_frame_end(&state, nullptr, 0))) break;
+		}
+		sync_times.sort();
+
+		const actions_level_t *level = &actions_sets[l];
+		ref_items->add(new_string("%d", actions_levels[l]));
+		ref_items->add(new_string("%d", actions_levels[l] * actions_type_max));
+		ref_items->add(new_string("%.3f (%d accepted)", level->suggest_ms, level->accepted));
+		ref_items->add("");
+		ref_items->add(sync_times.count == 0
+			? "None"
+			: new_string("%.1f / %.1f",
+				live_percentile(sync_times.data, (int32_t)sync_times.count, 50),
+				live_percentile(sync_times.data, (int32_t)sync_times.count, 99)));
+		ref_items->add(openxr_result_string(sync_result));
+		if (XR_FAILED(result)) break;
+	}
+	sync_times.free();
+
+	int32_t total = 0;
+	for (int32_t l = 0; l < actions_level_count; l++) total += actions_levels[l] * actions_type_max;
+	ref_items->add("All sets");
+	ref_items->add(new_string("%d", total));
+	ref_items->add(new_string("%.3f (%d accepted)", actions_suggest_all_ms, actions_suggest_all_ok));
+	ref_items->add(new_string("%.3f", actions_attach_ms));
+	ref_items->add("");
+	ref_items->add(XR_FAILED(result) ? openxr_result_string(result) : "");
+	return nullptr;
+}
+
+///////////////////////////////////////////
+
+void actions_release() {
+	for (int32_t l = 0; l < actions_level_count; l++) {
+		if (actions_sets[l].set != XR_NULL_HANDLE)
+			xrDestroyActionSet(actions_sets[l].set);
+		actions_sets[l].actions.free();
+		actions_sets[l] = {};
+	}
+	actions_attached       = false;
+	actions_attach_ms      = 0;
+	actions_suggest_all_ms = 0;
+	actions_suggest_all_ok = 0;
+}
+
+///////////////////////////////////////////
+
+XrResult actions_create_set(const char *name, int32_t per_type, XrActionSet *out_set, array_t<XrAction> *out_actions) {
+	XrActionSetCreateInfo set_info = { XR_TYPE_ACTION_SET_CREATE_INFO };
+	snprintf(set_info.actionSetName,          sizeof(set_info.actionSetName),          "%s", name);
+	snprintf(set_info.localizedActionSetName, sizeof(set_info.localizedActionSetName), "%s", name);
+	XrResult result = xrCreateActionSet(xr_instance, &set_info, out_set);
+	if (XR_FAILED(result)) return result;
+
+	// Type major, so all the actions of one type sit together
+	for (int32_t t = 0; t < actions_type_max; t++) {
+		for (int32_t i = 0; i < per_type; i++) {
+			XrActionCreateInfo info = { XR_TYPE_ACTION_CREATE_INFO };
+			info.actionType = actions_types[t];
+			snprintf(info.actionName,          sizeof(info.actionName),          "%s_%d", actions_type_names[t], i);
+			snprintf(info.localizedActionName, sizeof(info.localizedActionName), "%s %d", actions_type_names[t], i);
+			XrAction action = XR_NULL_HANDLE;
+			if (XR_FAILED(result = xrCreateAction(*out_set, &info, &action))) return result;
+			out_actions->add(action);
+		}
+	}
+	return XR_SUCCESS;
+}
+
+///////////////////////////////////////////
+
+void actions_bindings(const actions_profile_t *profile, const XrAction *actions, int32_t per_type, array_t<XrActionSuggestedBinding> *ref_bindings) {
+	for (int32_t t = 0; t < actions_type_max; t++) {
+		if (profile->inputs[t] == nullptr) continue;
+		for (int32_t u = 0; u < 2; u++) {
+			if (profile->users[u] == nullptr) continue;
+
+			char   path_str[XR_MAX_PATH_LENGTH];
+			XrPath path = XR_NULL_PATH;
+			snprintf(path_str, sizeof(path_str), "%s%s", profile->users[u], profile->inputs[t]);
+			if (XR_FAILED(paths_from_string(path_str, &path))) continue;
+			for (int32_t i = 0; i < per_type; i++)
+				ref_bindings->add({ actions[t * per_type + i], path });
+		}
+	}
+}
+
+///////////////////////////////////////////
+
+XrResult actions_suggest(const actions_profile_t *profile, const array_t<XrActionSuggestedBinding> *bindings, float *out_ms) {
+	XrInteractionProfileSuggestedBinding suggested = { XR_TYPE_INTERACTION_PROFILE_SUGGESTED_BINDING };
+	XrResult result = paths_from_string(profile->path, &suggested.interactionProfile);
+	if (XR_FAILED(result)) return result;
+	suggested.countSuggestedBindings = (uint32_t)bindings->count;
+	suggested.suggestedBindings      = bindings->data;
+
+	auto start = std::chrono::steady_clock::now();
+	result = xrSuggestInteractionProfileBindings(xr_instance, &suggested);
+	if (out_ms) *out_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+	return result;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "array.h"
+#include "openxr_info.h"
+
+#include <openxr/openxr.h>
+
+// Probes the action system with the interaction profiles from the core
+// spec. Bindings are one input per action type on each profile, and every
+// action of a type shares it.
+
+// Suggests bindings on each profile for an action set of its own, and
+// remembers whether the runtime took them. Nothing can be suggested once a
+// session has sets attached, so this goes right after xrCreateInstance.
+void     actions_probe_profiles();
+// Lists what actions_probe_profiles found. Rows of profile, result, and
+// binding count, so ref_records needs those three columns.
+XrResult actions_load_profiles(xr_records_t *ref_records);
+// Forgets the probe, for when the instance (and its set) goes away.
+void     actions_release_profiles();
+
+// A live test. Creates action sets with more and more actions of each
+// type, times suggesting bindings for each, then attaches them all and
+// times xrSyncActions on each set. Sets can only be attached once per
+// session, so running it again only redoes the syncing.
+const char *actions_benchmark(float duration_sec, array_t<const char *> *ref_items);
+
+// Destroys the benchmark's action sets, before the session goes.
+void actions_release();
@@ -0,0 +1,205 @@
+#include "openxr_bisect.h"
+#include "openxr_info.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <spawn.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+extern char **environ;
+#endif
+
+/*** Global Variables ********************/
+
+// Every probe is a whole process creating an XrInstance, so keep a lid on
+// how many of them run at once, and how long they get.
+const int32_t bisect_max_jobs   = 8;
+const int32_t bisect_timeout_ms = 10000;
+
+char                    bisect_exe[1024] = {};
+int32_t                 bisect_jobs      = 0;
+std::mutex              bisect_jobs_lock;
+std::condition_variable bisect_jobs_cond;
+
+array_t<const char *>   bisect_rejected  = {};
+std::mutex              bisect_rejected_lock;
+
+/*** Signatures **************************/
+
+bool                  bisect_test  (array_t<const char *> base, array_t<const char *> candidates);
+bool                  bisect_spawn (const char **args, size_t arg_count);
+array_t<const char *> bisect_accept(array_t<const char *> base, array_t<const char *> candidates);
+
+/*** Code ********************************/
+
+int32_t openxr_bisect_probe(int32_t ext_count, const char **ext_names) {
+	XrInstance instance = XR_NULL_HANDLE;
+	XrResult   result   = openxr_create_instance(ext_names, (uint32_t)ext_count, &instance);
+	if (XR_FAILED(result))
+		return 1;
+	xrDestroyInstance(instance);
+	return 0;
+}
+
+///////////////////////////////////////////
+
+bool openxr_bisect_extensions(array_t<const char *> ext_names, array_t<const char *> *out_accepted, array_t<const char *> *out_rejected) {
+	if (!openxr_exe_path(bisect_exe, sizeof(bisect_exe)))
+		return false;
+
+	// If nothing works, it's not the extensions' fault
+	array_t<const char *> none = {};
+	if (!bisect_test(none, none))
+		return false;
+
+	*out_accepted = bisect_accept(none, ext_names);
+
+	bisect_rejected.sort([](const char * const &a, const char * const &b) { return (int32_t)strcmp(a, b); });
+	out_rejected->add_range(bisect_rejected.data, bisect_rejected.count);
+	bisect_rejected.free();
+	return true;
+}
+
+///////////////////////////////////////////
+
+// Expects that base + candidates has already failed, and that base works on
+// its own. Returns the candidates that can be added to base.
+array_t<const char *> bisect_accept(array_t<const char *> base, array_t<const char *> candidates) {
+	array_t<const char *> result = {};
+	if (candidates.count == 1) {
+		bisect_rejected_lock.lock();
+		bisect_rejected.add(candidates[0]);
+		bisect_rejected_lock.unlock();
+		return result;
+	}
+
+	array_t<const char *> left  = {};
+	array_t<const char *> right = {};
+	left .add_range(candidates.data,              candidates.count / 2);
+	right.add_range(candidates.data + left.count, candidates.count - left.count);
+
+	// Each half works itself out at the same time as the other
+	bool                  left_ok      = false;
+	bool                  right_ok     = false;
+	array_t<const char *> accept_left  = {};
+	array_t<const char *> accept_right = {};
+	std::thread left_thread([&]() {
+		left_ok     = bisect_test(base, left);
+		accept_left = left_ok ? left.copy() : bisect_accept(base, left);
+	});
+	right_ok     = bisect_test(base, right);
+	accept_right = right_ok ? right.copy() : bisect_accept(base, right);
+	left_thread.join();
+	left .free();
+	right.free();
+
+	// Both halves can be fine on their own and still conflict with each
+	// other. If both passed untouched, we already know they do.
+	bool conflict = left_ok && right_ok;
+	if (!conflict && accept_left.count > 0 && accept_right.count > 0) {
+		array_t<const char *> base_left = base.copy();
+		base_left.add_range(accept_left.data, accept_left.count);
+		conflict = !bisect_test(base_left, accept_right);
+		base_left.free();
+	}
+
+	if (conflict) {
+		array_t<const char *> base_left = base.copy();
+		base_left.add_range(accept_left.data, accept_left.count);
+		array_t<const char *> accept_rest = bisect_accept(base_left, accept_right);
+		accept_right.free();
+		accept_right = accept_rest;
+		base_left.free();
+	}
+
+	result.add_range(accept_left .data, accept_left .count);
+	result.add_range(accept_right.data, accept_right.count);
+	accept_left .free();
+	accept_right.free();
+	return result;
+}
+
+///////////////////////////////////////////
+
+bool bisect_test(array_t<const char *> base, array_t<const char *> candidates) {
+	array_t<const char *> args = {};
+	args.add(bisect_exe);
+	args.add("-probeinstance");
+	args.add_range(base      .data, base      .count);
+	args.add_range(candidates.data, candidates.count);
+	args.add(nullptr);
+
+	{
+		std::unique_lock<std::mutex> lock(bisect_jobs_lock);
+		bisect_jobs_cond.wait(lock, []() { return bisect_jobs < bisect_max_jobs; });
+		bisect_jobs += 1;
+	}
+	bool result = bisect_spawn(args.data, args.count - 1);
+	{
+		std::unique_lock<std::mutex> lock(bisect_jobs_lock);
+		bisect_jobs -= 1;
+	}
+	bisect_jobs_cond.notify_one();
+
+	args.free();
+	return result;
+}
+
+///////////////////////////////////////////
+
+// args must be null terminated, arg_count doesn't include the terminator.
+bool bisect_spawn(const char **args, size_t arg_count) {
+#if defined(_WIN32)
+	// Extension names never have spaces, only the exe path needs quotes
+	size_t cmd_size = 3;
+	for (size_t i = 0; i < arg_count; i++)
+		cmd_size += strlen(args[i]) + 1;
+	char  *cmd = (char*)malloc(cmd_size);
+	size_t at  = snprintf(cmd, cmd_size, "\"%s\"", args[0]);
+	for (size_t i = 1; i < arg_count; i++)
+		at += snprintf(&cmd[at], cmd_size - at, " %s", args[i]);
+
+	STARTUPINFOA        startup = { sizeof(startup) };
+	PROCESS_INFORMATION process = {};
+	bool created = CreateProcessA(args[0], cmd, nullptr, nullptr, false, CREATE_NO_WINDOW, nullptr, nullptr, &startup, &process);
+	free(cmd);
+	if (!created)
+		return false;
+
+	DWORD exit_code = 1;
+	if (WaitForSingleObject(process.hProcess, bisect_timeout_ms) == WAIT_TIMEOUT) {
+		TerminateProcess(process.hProcess, 1);
+		WaitForSingleObject(process.hProcess, INFINITE);
+	} else {
+		GetExitCodeProcess(process.hProcess, &exit_code);
+	}
+	CloseHandle(process.hThread);
+	CloseHandle(process.hProcess);
+	return exit_code == 0;
+#else
+	pid_t pid    = 0;
+	int   status = 0;
+	if (posix_spawn(&pid, args[0], nullptr, nullptr, (char**)args, environ) != 0)
+		return false;
+
+	pid_t waited_pid = 0;
+	for (int32_t waited = 0; (waited_pid = waitpid(pid, &status, WNOHANG)) == 0; waited += 10) {
+		if (waited > bisect_timeout_ms) {
+			kill(pid, SIGKILL);
+			waitpid(pid, &status, 0);
+			return false;
+		}
+		usleep(10 * 1000);
+	}
+	return waited_pid == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+#endif
+}
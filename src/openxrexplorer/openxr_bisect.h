@@ -0,0 +1,14 @@
+#pragma once
+
+#include "array.h"
+
+#include <stdint.h>
+
+// Runs in a child process, tries to create an XrInstance with the given
+// extensions, and returns the process exit code: 0 on success.
+int32_t openxr_bisect_probe(int32_t ext_count, const char **ext_names);
+
+// Finds the largest set of extensions xrCreateInstance will accept, probing
+// candidate sets in parallel child processes so a misbehaving runtime can't
+// take the explorer down with it. Returns false if no set works at all.
+bool openxr_bisect_extensions(array_t<const char *> ext_names, array_t<const char *> *out_accepted, array_t<const char *> *out_rejected);
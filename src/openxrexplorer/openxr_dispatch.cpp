@@ -0,0 +1,50 @@
+#include "openxr_dispatch.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/*** Types *******************************/
+
+struct dispatch_entry_t {
+	const char *extension;
+	const char *function;
+	size_t      offset;
+};
+
+/*** Global Variables ********************/
+
+xr_dispatch_t xr_ext = {};
+
+#define DISPATCH_ENTRY(extension, function) { #extension, #function, offsetof(xr_dispatch_t, function) },
+const dispatch_entry_t dispatch_entries[] = { DISPATCH_LIST(DISPATCH_ENTRY) };
+#undef DISPATCH_ENTRY
+const int32_t dispatch_entry_count = sizeof(dispatch_entries) / sizeof(dispatch_entries[0]);
+
+/*** Code ********************************/
+
+void dispatch_load(XrInstance instance) {
+	dispatch_clear();
+
+	// Functions come in runs from the same extension, so each extension
+	// only gets checked once.
+	const char *ext     = nullptr;
+	bool        has_ext = false;
+	for (int32_t i = 0; i < dispatch_entry_count; i++) {
+		const dispatch_entry_t *entry = &dispatch_entries[i];
+		if (ext == nullptr || strcmp(ext, entry->extension) != 0) {
+			ext     = entry->extension;
+			has_ext = openxr_has_ext(ext);
+		}
+		if (!has_ext) continue;
+
+		PFN_xrVoidFunction *function = (PFN_xrVoidFunction *)((uint8_t *)&xr_ext + entry->offset);
+		if (XR_FAILED(xrGetInstanceProcAddr(instance, entry->function, function)))
+			*function = nullptr;
+	}
+}
+
+///////////////////////////////////////////
+
+void dispatch_clear() {
+	xr_ext = {};
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "openxr_info.h"
+
+// Extension functions, looked up once when the instance is made instead of
+// wherever they're used. Only extensions the instance has enabled get
+// looked up, everything else stays nullptr.
+//
+// The list comes from xr.xml by way of xrgenerator when the build has the
+// OpenXR registry, otherwise it's just the functions the explorer uses.
+
+#if __has_include("openxr_generated_dispatch.h")
+#include "openxr_generated_dispatch.h"
+#else
+#define DISPATCH_LIST(_) \
+	_(XR_KHR_visibility_mask, xrGetVisibilityMaskKHR) \
+	_(XR_FB_color_space, xrEnumerateColorSpacesFB) \
+	_(XR_FB_display_refresh_rate, xrEnumerateDisplayRefreshRatesFB) \
+	_(XR_FB_display_refresh_rate, xrGetDisplayRefreshRateFB) \
+	_(XR_FB_display_refresh_rate, xrRequestDisplayRefreshRateFB) \
+	_(XR_FB_render_model, xrEnumerateRenderModelPathsFB) \
+	_(XR_HTCX_vive_tracker_interaction, xrEnumerateViveTrackerPathsHTCX) \
+	_(XR_META_performance_metrics, xrEnumeratePerformanceMetricsCounterPathsMETA) \
+	_(XR_META_performance_metrics, xrSetPerformanceMetricsStateMETA) \
+	_(XR_META_performance_metrics, xrQueryPerformanceMetricsCounterMETA) \
+	_(XR_MSFT_composition_layer_reprojection, xrEnumerateReprojectionModesMSFT) \
+	_(XR_MSFT_scene_understanding, xrEnumerateSceneComputeFeaturesMSFT) \
+
+#endif
+
+/*** Types *******************************/
+
+struct xr_dispatch_t {
+#define DISPATCH_MEMBER(extension, function) PFN_##function function;
+	DISPATCH_LIST(DISPATCH_MEMBER)
+#undef DISPATCH_MEMBER
+};
+
+/*** Global Variables ********************/
+
+extern xr_dispatch_t xr_ext;
+
+/*** Signatures **************************/
+
+void dispatch_load (XrInstance instance);
+void dispatch_clear();
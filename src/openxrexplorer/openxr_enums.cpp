@@ -0,0 +1,220 @@
+#include "openxr_enums.h"
+
+#include <openxr/openxr_reflection.h>
+
+/*** Types *******************************/
+
+struct enums_entry_t {
+	enum_type_  type;
+	int32_t     value;
+	const char *name;
+};
+
+// A CHD style minimal perfect hash. Keys get split into buckets, and each
+// bucket gets a seed that puts all of its keys in free slots. Buckets of
+// one just point straight at a free slot. There's a bucket per key, since
+// bigger buckets get very hard to place once the table is nearly full, and
+// would blow through the compiler's constexpr limits.
+template <int32_t N>
+struct enums_hash_t {
+	static constexpr int32_t bucket_count = N;
+	int32_t  seeds[bucket_count]; // Seed when positive, -(slot+1) when not
+	uint16_t slots[N];            // Entry index, or 0xFFFF
+	bool     ok;
+};
+
+template <int32_t N>
+struct enums_keys_t {
+	uint64_t keys[N];
+};
+
+/*** Code ********************************/
+
+constexpr uint64_t enums_mix(uint64_t key, uint64_t seed) {
+	// splitmix64's finalizer
+	uint64_t x = key ^ (seed * 0x9E3779B97F4A7C15ull);
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+	return x ^ (x >> 31);
+}
+
+///////////////////////////////////////////
+
+constexpr uint64_t enums_name_key(const char *name) {
+	// FNV-1a on the lower case text
+	uint64_t hash = 0xCBF29CE484222325ull;
+	for (; *name; name++) {
+		char c = *name >= 'A' && *name <= 'Z' ? *name + ('a' - 'A') : *name;
+		hash = (hash ^ (uint8_t)c) * 0x100000001B3ull;
+	}
+	return hash;
+}
+
+///////////////////////////////////////////
+
+constexpr uint64_t enums_value_key(enum_type_ type, int32_t value) {
+	return ((uint64_t)type << 32) | (uint32_t)value;
+}
+
+///////////////////////////////////////////
+
+template <int32_t N>
+constexpr enums_hash_t<N> enums_hash_build(const uint64_t (&keys)[N]) {
+	constexpr int32_t B = enums_hash_t<N>::bucket_count;
+	enums_hash_t<N> result = {};
+	result.ok = true;
+	for (int32_t i = 0; i < N; i++) result.slots[i] = 0xFFFF;
+
+	// Sort keys into buckets, counting sort style
+	int32_t bucket_of[N]      = {};
+	int32_t bucket_start[B+1] = {};
+	int32_t members[N]        = {};
+	for (int32_t i = 0; i < N; i++) {
+		bucket_of[i] = (int32_t)(enums_mix(keys[i], 0) % B);
+		bucket_start[bucket_of[i] + 1] += 1;
+	}
+	int32_t max_size = 0;
+	for (int32_t b = 0; b < B; b++) {
+		if (max_size < bucket_start[b+1]) max_size = bucket_start[b+1];
+		bucket_start[b+1] += bucket_start[b];
+	}
+	int32_t fill[B] = {};
+	for (int32_t i = 0; i < N; i++) {
+		int32_t b = bucket_of[i];
+		members[bucket_start[b] + fill[b]] = i;
+		fill[b] += 1;
+	}
+
+	// Biggest buckets first, while there's still lots of room. The same key
+	// twice, like an enum value with two names, always shares a bucket and
+	// only the first one gets a slot.
+	bool taken[N] = {};
+	for (int32_t size = max_size; size >= 2; size--) {
+		for (int32_t b = 0; b < B; b++) {
+			int32_t start = bucket_start[b];
+			if (bucket_start[b+1] - start != size) continue;
+			if (size > 64) { result.ok = false; continue; }
+
+			bool placed = false;
+			for (uint64_t seed = 1; seed < 100000 && !placed; seed++) {
+				int32_t slot_of[64] = {};
+				placed = true;
+				for (int32_t m = 0; m < size && placed; m++) {
+					uint64_t key = keys[members[start + m]];
+					slot_of[m] = -1;
+					bool duplicate = false;
+					for (int32_t p = 0; p < m; p++) duplicate = duplicate || keys[members[start + p]] == key;
+					if (duplicate) continue;
+
+					int32_t slot = (int32_t)(enums_mix(key, seed) % N);
+					for (int32_t p = 0; p < m; p++) placed = placed && slot_of[p] != slot;
+					placed     = placed && !taken[slot];
+					slot_of[m] = slot;
+				}
+				if (!placed) continue;
+
+				result.seeds[b] = (int32_t)seed;
+				for (int32_t m = 0; m < size; m++) {
+					if (slot_of[m] < 0) continue;
+					taken       [slot_of[m]] = true;
+					result.slots[slot_of[m]] = (uint16_t)members[start + m];
+				}
+			}
+			if (!placed) result.ok = false;
+		}
+	}
+
+	// Buckets of one can go anywhere
+	int32_t free_slot = 0;
+	for (int32_t b = 0; b < B; b++) {
+		if (bucket_start[b+1] - bucket_start[b] != 1) continue;
+		while (taken[free_slot]) free_slot++;
+		taken       [free_slot] = true;
+		result.slots[free_slot] = (uint16_t)members[bucket_start[b]];
+		result.seeds[b]         = -(free_slot + 1);
+	}
+	return result;
+}
+
+///////////////////////////////////////////
+
+template <int32_t N>
+int32_t enums_hash_find(const enums_hash_t<N> &hash, uint64_t key) {
+	int32_t seed = hash.seeds[enums_mix(key, 0) % enums_hash_t<N>::bucket_count];
+	int32_t slot = seed < 0
+		? -seed - 1
+		: (int32_t)(enums_mix(key, (uint64_t)seed) % N);
+	return hash.slots[slot] == 0xFFFF ? -1 : hash.slots[slot];
+}
+
+///////////////////////////////////////////
+// Tables                                //
+///////////////////////////////////////////
+
+// Types come from decltype so the registry and reflection lists can share
+// the same entry.
+#define ENUMS_ENTRY(name) { enums_type_t<decltype(name)>::id, (int32_t)name, #name },
+#if defined(ENUMS_LIST)
+#define ENUMS_GENERATED_ENTRY(type, name) ENUMS_ENTRY(name)
+constexpr enums_entry_t enums_entries[] = { ENUMS_LIST(ENUMS_GENERATED_ENTRY) };
+#undef ENUMS_GENERATED_ENTRY
+#else
+#define ENUMS_REFLECT_ENTRY(name, val) ENUMS_ENTRY(name)
+#define ENUMS_REFLECT_TYPE(type) XR_LIST_ENUM_##type(ENUMS_REFLECT_ENTRY)
+constexpr enums_entry_t enums_entries[] = { ENUM_TYPES_LIST(ENUMS_REFLECT_TYPE) };
+#undef ENUMS_REFLECT_TYPE
+#undef ENUMS_REFLECT_ENTRY
+#endif
+#undef ENUMS_ENTRY
+constexpr int32_t enums_entry_count = sizeof(enums_entries) / sizeof(enums_entries[0]);
+static_assert(enums_entry_count < 0xFFFF, "Too many enum values for 16 bit slots");
+
+// Keys and hashes are separate constants so that no one of them runs into
+// the compiler's limits on constexpr evaluation.
+constexpr enums_keys_t<enums_entry_count> enums_make_name_keys() {
+	enums_keys_t<enums_entry_count> result = {};
+	for (int32_t i = 0; i < enums_entry_count; i++) result.keys[i] = enums_name_key(enums_entries[i].name);
+	return result;
+}
+constexpr enums_keys_t<enums_entry_count> enums_make_value_keys() {
+	enums_keys_t<enums_entry_count> result = {};
+	for (int32_t i = 0; i < enums_entry_count; i++) result.keys[i] = enums_value_key(enums_entries[i].type, enums_entries[i].value);
+	return result;
+}
+constexpr enums_keys_t<enums_entry_count> enums_name_keys  = enums_make_name_keys ();
+constexpr enums_keys_t<enums_entry_count> enums_value_keys = enums_make_value_keys();
+constexpr enums_hash_t<enums_entry_count> enums_by_name    = enums_hash_build(enums_name_keys .keys);
+constexpr enums_hash_t<enums_entry_count> enums_by_value   = enums_hash_build(enums_value_keys.keys);
+static_assert(enums_by_name.ok && enums_by_value.ok, "Couldn't find a perfect hash for the enum tables");
+
+///////////////////////////////////////////
+// Lookups                               //
+///////////////////////////////////////////
+
+const char *enums_name(enum_type_ type, int32_t value) {
+	int32_t index = enums_hash_find(enums_by_value, enums_value_key(type, value));
+	if (index < 0) return nullptr;
+
+	const enums_entry_t *entry = &enums_entries[index];
+	return entry->type == type && entry->value == value ? entry->name : nullptr;
+}
+
+///////////////////////////////////////////
+
+bool enums_value(enum_type_ type, const char *name, int32_t *out_value) {
+	int32_t index = enums_hash_find(enums_by_name, enums_name_key(name));
+	if (index < 0) return false;
+
+	// Names are unique across every enum, so one that belongs to some other
+	// type isn't a match.
+	const enums_entry_t *entry = &enums_entries[index];
+	if (entry->type != type) return false;
+	for (const char *a = entry->name, *b = name; ; a++, b++) {
+		char ca = *a >= 'A' && *a <= 'Z' ? *a + ('a' - 'A') : *a;
+		char cb = *b >= 'A' && *b <= 'Z' ? *b + ('a' - 'A') : *b;
+		if (ca != cb) return false;
+		if (ca == '\0') break;
+	}
+	*out_value = entry->value;
+	return true;
+}
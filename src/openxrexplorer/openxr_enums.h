@@ -0,0 +1,60 @@
+#pragma once
+
+#include "openxr_info.h"
+
+// Names for enum values, and values for enum names, in both directions
+// through a pair of minimal perfect hashes. The hashes are worked out while
+// compiling, so a lookup is one hash, one table read and one compare, with
+// nothing to set up at runtime. Name lookups ignore case, so they work on
+// what people type at the command line.
+//
+// With the OpenXR registry, xrgenerator lists every enum the SDK has.
+// Otherwise the types below come from openxr_reflection.h.
+
+#if __has_include("openxr_generated_enums.h")
+#include "openxr_generated_enums.h"
+#else
+#define ENUM_TYPES_LIST(_) \
+	_(XrResult) \
+	_(XrStructureType) \
+	_(XrFormFactor) \
+	_(XrViewConfigurationType) \
+	_(XrEnvironmentBlendMode) \
+	_(XrReferenceSpaceType) \
+	_(XrSessionState) \
+	_(XrColorSpaceFB) \
+	_(XrReprojectionModeMSFT) \
+	_(XrSceneComputeFeatureMSFT) \
+
+#endif
+
+/*** Types *******************************/
+
+#define ENUMS_TYPE_ID(type) enum_type_##type,
+enum enum_type_ {
+	enum_type_none,
+	ENUM_TYPES_LIST(ENUMS_TYPE_ID)
+	enum_type_count,
+};
+#undef ENUMS_TYPE_ID
+
+template <typename T> struct enums_type_t { static constexpr enum_type_ id = enum_type_none; };
+#define ENUMS_TYPE_INFO(type) template <> struct enums_type_t<type> { static constexpr enum_type_ id = enum_type_##type; };
+ENUM_TYPES_LIST(ENUMS_TYPE_INFO)
+#undef ENUMS_TYPE_INFO
+
+/*** Signatures **************************/
+
+// nullptr for values the SDK doesn't know about
+const char *enums_name (enum_type_ type, int32_t value);
+bool        enums_value(enum_type_ type, const char *name, int32_t *out_value);
+
+template <typename T> const char *enums_name(T value) {
+	return enums_name(enums_type_t<T>::id, (int32_t)value);
+}
+template <typename T> bool enums_value(const char *name, T *out_value) {
+	int32_t value;
+	if (!enums_value(enums_type_t<T>::id, name, &value)) return false;
+	*out_value = (T)value;
+	return true;
+}
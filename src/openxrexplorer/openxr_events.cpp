@@ -0,0 +1,246 @@
+#include "openxr_events.h"
+#include "openxr_info.h"
+#include "openxr_live.h"
+#include "openxr_enums.h"
+#include "imgui/sokol_time.h"
+
+#include <openxr/openxr_reflection.h>
+
+#include <stdio.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+/*** Global Variables ********************/
+
+// Power of two, so counts map straight onto slots. The GUI drains it every
+// frame, so this only fills up if nobody is reading.
+const uint32_t events_queue_size = 256;
+// Events are timestamped when they're polled, so this is the resolution
+const int32_t  events_poll_ms    = 1;
+
+xr_event_t            events_queue[events_queue_size];
+std::atomic<uint64_t> events_pushed    = { 0 };
+std::atomic<uint64_t> events_popped    = { 0 };
+std::atomic<uint64_t> events_lost      = { 0 };
+
+std::atomic<bool>     events_active    = { false };
+std::thread           events_thread;
+uint64_t              events_created   = 0;
+
+// First time each session state or mark was seen, 0 if not yet
+const int32_t         events_state_max = XR_SESSION_STATE_EXITING + 1;
+std::atomic<uint64_t> events_state_ticks[events_state_max];
+std::atomic<uint64_t> events_mark_ticks [events_mark_max];
+std::atomic<int32_t>  events_state     = { XR_SESSION_STATE_UNKNOWN };
+
+/*** Signatures **************************/
+
+void events_poller();
+void events_push  (const xr_event_t *event);
+
+/*** Code ********************************/
+
+void events_start(uint64_t create_tick) {
+	events_stop();
+	events_created = create_tick;
+	for (int32_t i = 0; i < events_state_max; i++) events_state_ticks[i].store(0);
+	for (int32_t i = 0; i < events_mark_max;  i++) events_mark_ticks [i].store(0);
+	events_state.store(XR_SESSION_STATE_UNKNOWN);
+	events_mark(events_mark_created);
+
+	events_active.store(true);
+	events_thread = std::thread(events_poller);
+}
+
+///////////////////////////////////////////
+
+void events_stop() {
+	if (!events_active.exchange(false))
+		return;
+	events_thread.join();
+}
+
+///////////////////////////////////////////
+
+XrSessionState events_session_state() {
+	return (XrSessionState)events_state.load();
+}
+
+///////////////////////////////////////////
+
+void events_mark(events_mark_ mark) {
+	uint64_t none = 0;
+	events_mark_ticks[mark].compare_exchange_strong(none, stm_now());
+}
+
+///////////////////////////////////////////
+
+double events_state_time(XrSessionState state) {
+	if (state < 0 || state >= events_state_max) return -1;
+	uint64_t tick = events_state_ticks[state].load();
+	return tick == 0 ? -1 : stm_sec(stm_diff(tick, events_created));
+}
+
+///////////////////////////////////////////
+
+double events_mark_time(events_mark_ mark) {
+	uint64_t tick = events_mark_ticks[mark].load();
+	return tick == 0 ? -1 : stm_sec(stm_diff(tick, events_created));
+}
+
+///////////////////////////////////////////
+
+const char *events_lifecycle(float duration_sec, array_t<const char *> *ref_items) {
+	XrResult result = live_session_begin();
+	if (XR_FAILED(result)) return openxr_result_string(result);
+
+	// FOCUSED can be waiting on someone to put the headset on, so frames
+	// keep going for the whole duration rather than stopping there.
+	auto start = std::chrono::steady_clock::now();
+	while (!live_cancelled()) {
+		float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+		if (elapsed > duration_sec) break;
+		live_set_progress(elapsed / duration_sec);
+
+		XrFrameState state = { XR_TYPE_FRAME_STATE };
+		if (XR_FAILED(result = live_frame_begin(&state))) break;
+		if (XR_FAILED(result = live_frame_end  (&state, nullptr, 0))) break;
+	}
+
+	struct step_t { const char *name; double time; };
+	const step_t steps[] = {
+		{ "xrCreateSession returned",      events_mark_time (events_mark_created) },
+		{ "XR_SESSION_STATE_IDLE",         events_state_time(XR_SESSION_STATE_IDLE) },
+		{ "XR_SESSION_STATE_READY",        events_state_time(XR_SESSION_STATE_READY) },
+		{ "xrBeginSession called",         events_mark_time (events_mark_begin) },
+		{ "xrBeginSession returned",       events_mark_time (events_mark_begun) },
+		{ "XR_SESSION_STATE_SYNCHRONIZED", events_state_time(XR_SESSION_STATE_SYNCHRONIZED) },
+		{ "XR_SESSION_STATE_VISIBLE",      events_state_time(XR_SESSION_STATE_VISIBLE) },
+		{ "XR_SESSION_STATE_FOCUSED",      events_state_time(XR_SESSION_STATE_FOCUSED) },
+	};
+
+	ref_items->add("Step");
+	ref_items->add("Since xrCreateSession (ms)");
+	ref_items->add("Since previous (ms)");
+	double prev = 0;
+	for (size_t i = 0; i < sizeof(steps)/sizeof(steps[0]); i++) {
+		ref_items->add(steps[i].name);
+		if (steps[i].time < 0) {
+			ref_items->add("Never");
+			ref_items->add("");
+			continue;
+		}
+		ref_items->add(new_string("%.2f", steps[i].time * 1000));
+		ref_items->add(new_string("%.2f", (steps[i].time - prev) * 1000));
+		prev = steps[i].time;
+	}
+	if (XR_FAILED(result)) {
+		ref_items->add("Frame loop stopped");
+		ref_items->add(openxr_result_string(result));
+		ref_items->add("");
+	}
+	return nullptr;
+}
+
+///////////////////////////////////////////
+
+void events_poller() {
+	while (events_active.load()) {
+		XrEventDataBuffer buffer = { XR_TYPE_EVENT_DATA_BUFFER };
+		if (xrPollEvent(xr_instance, &buffer) != XR_SUCCESS) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(events_poll_ms));
+			continue;
+		}
+
+		uint64_t   now   = stm_now();
+		xr_event_t event = {};
+		event.time = stm_sec(stm_diff(now, events_created));
+		event.type = buffer.type;
+
+		switch (buffer.type) {
+		case XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED: {
+			const XrEventDataSessionStateChanged *changed = (XrEventDataSessionStateChanged *)&buffer;
+			event.xr_time = changed->time;
+			event.state   = changed->state;
+			snprintf(event.detail, sizeof(event.detail), "%s", events_state_name(changed->state));
+			if (changed->session == xr_session) {
+				events_state.store(changed->state);
+				uint64_t none = 0;
+				if (changed->state >= 0 && changed->state < events_state_max)
+					events_state_ticks[changed->state].compare_exchange_strong(none, now);
+			}
+		} break;
+		case XR_TYPE_EVENT_DATA_INSTANCE_LOSS_PENDING: {
+			const XrEventDataInstanceLossPending *loss = (XrEventDataInstanceLossPending *)&buffer;
+			event.xr_time = loss->lossTime;
+		} break;
+		case XR_TYPE_EVENT_DATA_REFERENCE_SPACE_CHANGE_PENDING: {
+			const XrEventDataReferenceSpaceChangePending *change = (XrEventDataReferenceSpaceChangePending *)&buffer;
+			const char *space = enums_name(change->referenceSpaceType);
+			if (space == nullptr) space = "Unknown space";
+			event.xr_time = change->changeTime;
+			snprintf(event.detail, sizeof(event.detail), "%s, pose %s", space, change->poseValid ? "valid" : "invalid");
+		} break;
+		case XR_TYPE_EVENT_DATA_EVENTS_LOST: {
+			const XrEventDataEventsLost *lost = (XrEventDataEventsLost *)&buffer;
+			snprintf(event.detail, sizeof(event.detail), "%u lost", lost->lostEventCount);
+		} break;
+		case XR_TYPE_EVENT_DATA_DISPLAY_REFRESH_RATE_CHANGED_FB: {
+			const XrEventDataDisplayRefreshRateChangedFB *rate = (XrEventDataDisplayRefreshRateChangedFB *)&buffer;
+			snprintf(event.detail, sizeof(event.detail), "%g -> %g Hz", rate->fromDisplayRefreshRate, rate->toDisplayRefreshRate);
+		} break;
+		case XR_TYPE_EVENT_DATA_VISIBILITY_MASK_CHANGED_KHR: {
+			const XrEventDataVisibilityMaskChangedKHR *mask = (XrEventDataVisibilityMaskChangedKHR *)&buffer;
+			snprintf(event.detail, sizeof(event.detail), "view %u", mask->viewIndex);
+		} break;
+		default: break; // Interaction profile changes and the like are news enough on their own
+		}
+		events_push(&event);
+	}
+}
+
+///////////////////////////////////////////
+
+void events_push(const xr_event_t *event) {
+	// Only the poller pushes, so the count can't change under us
+	uint64_t pushed = events_pushed.load(std::memory_order_relaxed);
+	if (pushed - events_popped.load(std::memory_order_acquire) >= events_queue_size) {
+		events_lost.fetch_add(1);
+		return;
+	}
+	events_queue[pushed & (events_queue_size - 1)] = *event;
+	events_pushed.store(pushed + 1, std::memory_order_release);
+}
+
+///////////////////////////////////////////
+
+bool events_pop(xr_event_t *out_event) {
+	uint64_t popped = events_popped.load(std::memory_order_relaxed);
+	if (popped == events_pushed.load(std::memory_order_acquire))
+		return false;
+	*out_event = events_queue[popped & (events_queue_size - 1)];
+	events_popped.store(popped + 1, std::memory_order_release);
+	return true;
+}
+
+///////////////////////////////////////////
+
+uint64_t events_dropped() {
+	return events_lost.load();
+}
+
+///////////////////////////////////////////
+
+const char *events_type_name(XrStructureType type) {
+	const char *name = enums_name(type);
+	return name ? name : "Unknown event";
+}
+
+///////////////////////////////////////////
+
+const char *events_state_name(XrSessionState state) {
+	const char *name = enums_name(state);
+	return name ? name : "Unknown state";
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "array.h"
+
+#include <openxr/openxr.h>
+#include <stdint.h>
+
+// Polls xrPollEvent on a thread of its own while there's a session, and
+// timestamps everything that comes in. Events are handed over through a
+// lock-free queue, so the poller never waits on whoever is reading them.
+
+/*** Types *******************************/
+
+struct xr_event_t {
+	// Seconds since xrCreateSession was called
+	double          time;
+	XrStructureType type;
+	// When the runtime says it happened, 0 if the event doesn't say
+	XrTime          xr_time;
+	// Only for session state changes
+	XrSessionState  state;
+	char            detail[64];
+};
+
+// Things the app does that are worth timing against the events.
+enum events_mark_ {
+	events_mark_created,
+	events_mark_begin,
+	events_mark_begun,
+	events_mark_max,
+};
+
+/*** Signatures **************************/
+
+// create_tick is the stm_now() from right before xrCreateSession.
+void events_start(uint64_t create_tick);
+void events_stop ();
+
+XrSessionState events_session_state();
+void           events_mark         (events_mark_ mark);
+
+// Seconds from xrCreateSession being called until the session first hit
+// that state, or until the mark. Negative if it hasn't happened yet.
+double events_state_time(XrSessionState state);
+double events_mark_time (events_mark_ mark);
+
+// Only one thread should pop. Returns false if the queue is empty.
+bool     events_pop    (xr_event_t *out_event);
+uint64_t events_dropped();
+
+const char *events_type_name (XrStructureType type);
+const char *events_state_name(XrSessionState state);
+
+// A live test. Begins the session and runs frames for duration_sec, then
+// reports when each step from xrCreateSession to FOCUSED happened.
+const char *events_lifecycle(float duration_sec, array_t<const char *> *ref_items);
@@ -1,33 +1,66 @@
 #include "openxr_info.h"
 #include "openxr_properties.h"
+#include "openxr_bisect.h"
+#include "openxr_visibility.h"
+#include "openxr_metrics.h"
+#include "openxr_live.h"
+#include "openxr_events.h"
+#include "openxr_actions.h"
+#include "openxr_paths.h"
+#include "openxr_records.h"
+#include "openxr_dispatch.h"
+#include "openxr_enums.h"
+#include "xrsnapshot.h"
+#include "imgui/sokol_time.h"
 
 #if defined(__linux__)
 #include <GL/glxew.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <windows.h>
 #endif
 
 #include <openxr/openxr_platform.h>
 #include <openxr/openxr_reflection.h>
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdarg.h>
 #include <malloc.h>
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 /*** Types *******************************/
 
 struct xr_extensions_t {
 	array_t<XrExtensionProperties> extensions;
 	array_t<XrApiLayerProperties>  layers;
+	array_t<const char *>          rejected;
 };
 
 /*** Global Variables ********************/
 
 array_t<display_table_t> xr_tables        = {};
 array_t<char *>          xr_table_strings = {};
-
-array_t<xr_enum_info_t> xr_misc_enums = {};
-xr_properties_t         xr_properties = {};
-xr_view_info_t          xr_view       = {};
-xr_extensions_t         xr_extensions = {};
+std::mutex               xr_table_strings_lock;
+
+// Tables load lazily. Misc enum tables sit at the end of xr_tables as
+// pending placeholders from the start, everything else is loaded a tag at a
+// time and slotted in before them, so table order never depends on what got
+// looked at first.
+xr_settings_t xr_settings        = {};
+bool          xr_tag_loaded   [display_tag_misc + 1] = {};
+bool          xr_tag_requested[display_tag_misc + 1] = {};
+size_t        xr_tables_group_end = 0;
+
+array_t<xr_enum_info_t>   xr_misc_enums = {};
+array_t<xr_system_info_t> xr_systems    = {};
+xr_properties_t           xr_properties = {};
+xr_view_info_t            xr_view       = {};
+xr_extensions_t           xr_extensions = {};
 
 XrInstance  xr_instance     = {};
 const char *xr_instance_err = nullptr;
@@ -38,6 +71,14 @@ const char *xr_system_err   = nullptr;
 
 const char* xr_runtime_name = "No runtime set";
 
+xr_timings_t xr_timings = {};
+
+snapshot_writer_t *xr_capture = nullptr;
+
+// Misc enum loaders run in parallel, each call is often a round trip to a
+// runtime service, so this is mostly about overlapping latency.
+const int32_t xr_max_workers = 8;
+
 #define XR_NEXT_INSERT(obj, obj_next) obj_next.next = obj.next; obj.next = &obj_next;
 
 /*** Signatures **************************/
@@ -49,53 +90,194 @@ void openxr_init_session ();
 xr_extensions_t openxr_load_exts      ();
 xr_properties_t openxr_load_properties();
 xr_view_info_t  openxr_load_view      (XrViewConfigurationType view_config);
-void            openxr_load_enums     (xr_settings_t settings);
 const char *    openxr_result_string  (XrResult result);
 void            openxr_register_enums ();
-bool            openxr_has_ext        (const char *ext_name);
+void            openxr_tables_settle  ();
+void            openxr_require_instance();
+void            openxr_require_system ();
+void            openxr_parallel_for   (int32_t count, bool serial, void *data, void (*job)(void *data, int32_t index));
+XrResult        openxr_get_visibility (PFN_xrGetVisibilityMaskKHR get_mask, XrViewConfigurationType view_config, uint32_t view, XrVisibilityMaskTypeKHR type, array_t<XrVector2f> *out_verts, array_t<uint32_t> *out_inds);
+void            openxr_free_visibility(array_t<xr_visibility_mask_t> *ref_masks);
 
 
 /*** Code ********************************/
 
 void openxr_info_reload(xr_settings_t settings) {
 	openxr_info_release();
+	xr_settings = settings;
+
+	openxr_register_enums();
+	for (size_t i = 0; i < xr_misc_enums.count; i++) {
+		display_table_t table = {};
+		table.name_func = xr_misc_enums[i].source_fn_name;
+		table.name_type = xr_misc_enums[i].source_type_name;
+		table.spec      = xr_misc_enums[i].spec_link;
+		table.tag       = xr_misc_enums[i].tag;
+		table.show_type    = table.name_func == nullptr;
+		table.column_count = xr_misc_enums[i].column_count > 1 ? xr_misc_enums[i].column_count : 1;
+		if (xr_misc_enums[i].records.column_count > 0)
+			table.column_count = xr_misc_enums[i].records.column_count;
+		table.header_row   = table.column_count > 1;
+		table.pending      = true;
+		table.misc_enum    = (int32_t)i;
+		xr_tables.add(table);
+	}
+
+	// A capture is only useful if it has everything in it
+	if (settings.capture_file != nullptr) {
+		xr_capture = snapshot_writer_create();
+		openxr_load_all();
+
+		if (xr_session) {
+			events_stop();
+			XrResult result = xrDestroySession(xr_session);
+			openxr_capture("xrDestroySession", 0, result, nullptr, 0, 0);
+			xr_session = XR_NULL_HANDLE;
+		}
+
+		if (!snapshot_writer_save(xr_capture, settings.capture_file))
+			printf("Failed to save snapshot to %s!\n", settings.capture_file);
+		snapshot_writer_destroy(xr_capture);
+		xr_capture = nullptr;
+	}
+}
+
+///////////////////////////////////////////
+
+void openxr_request_tag(display_tag_ tag) {
+	if (tag <= display_tag_misc && !xr_tag_loaded[tag])
+		xr_tag_requested[tag] = true;
+}
+
+///////////////////////////////////////////
+
+void openxr_load_tag(display_tag_ tag) {
+	xr_tag_requested[tag] = false;
+	if (xr_tag_loaded[tag]) return;
+	xr_tag_loaded[tag] = true;
+
+	switch (tag) {
+	case display_tag_features: {
+		// The first call into the loader is where it finds and loads the
+		// runtime, so that's most of what this measures.
+		uint64_t start = stm_now();
+		xr_extensions = openxr_load_exts();
+		xr_timings.loader = stm_since(start);
+	} break;
+	case display_tag_properties: openxr_require_system(); xr_properties = openxr_load_properties(); break;
+	case display_tag_view:       openxr_require_system(); xr_view       = openxr_load_view(xr_settings.view_config); break;
+	default: break; // Misc enums load a table at a time
+	}
+	openxr_tables_settle();
+}
+
+///////////////////////////////////////////
+
+bool openxr_load_next() {
+	for (int32_t i = 0; i <= display_tag_misc; i++) {
+		if (xr_tag_loaded[i]) continue;
+		openxr_load_tag((display_tag_)i);
+		return true;
+	}
+	return false;
+}
 
-	xr_extensions = openxr_load_exts();
+///////////////////////////////////////////
+
+void openxr_load_all() {
+	while (openxr_load_next());
+	for (size_t i = 0; i < xr_tables.count; i++) {
+		if (xr_tables[i].pending) xr_tables[i].requested = true;
+	}
+	openxr_load_requested();
+}
+
+///////////////////////////////////////////
+
+// Moves any tables that were appended after the misc enum placeholders to
+// just before them.
+void openxr_tables_settle() {
+	size_t misc_end = xr_tables_group_end + xr_misc_enums.count;
+	if (xr_tables.count <= misc_end) return;
+
+	std::rotate(&xr_tables.data[xr_tables_group_end], &xr_tables.data[misc_end], &xr_tables.data[xr_tables.count]);
+	xr_tables_group_end += xr_tables.count - misc_end;
+}
+
+///////////////////////////////////////////
+
+display_table_t *openxr_add_table(display_table_t table) {
+	xr_tables.add(table);
+	openxr_tables_settle();
+	return &xr_tables[xr_tables_group_end - 1];
+}
+
+///////////////////////////////////////////
+
+void openxr_require_instance() {
+	openxr_load_tag(display_tag_features);
 	openxr_init_instance(xr_extensions.extensions);
-	openxr_init_system  (settings.form);
-	xr_properties = openxr_load_properties();
-	xr_view       = openxr_load_view      (settings.view_config);
+	openxr_tables_settle();
+}
 
-	openxr_register_enums();
-	openxr_load_enums    (settings);
+///////////////////////////////////////////
+
+void openxr_require_system() {
+	openxr_require_instance();
+	openxr_init_system(xr_settings.form);
+}
+
+///////////////////////////////////////////
 
-	if (xr_session) {
-		xrDestroySession(xr_session);
-		xr_session = XR_NULL_HANDLE;
+void openxr_require_session() {
+	openxr_require_system();
+	if (xr_settings.allow_session) {
+		openxr_init_session();
+	} else if (!xr_session_err) {
+		xr_session_err = "Reload with Session enabled";
 	}
 }
 
 ///////////////////////////////////////////
 
 void openxr_info_release() {
-	xr_misc_enums.each([](xr_enum_info_t &i) { i.items.free(); });
+	// Live tests make strings and tables from their own thread
+	live_release();
+
+	xr_misc_enums.each([](xr_enum_info_t &i) { i.items.free(); records_free(&i.records); });
 	xr_misc_enums.free();
 	xr_properties = {};
-	xr_view.available_configs     .free();
-	xr_view.available_config_names.free();
-	xr_view.config_views          .free();
+	xr_view.configs.each([](xr_view_config_info_t &c) {
+		c.views             .free();
+		c.blend_modes       .free();
+		c.reprojection_modes.free();
+		openxr_free_visibility(&c.visibility_masks);
+	});
+	xr_view.configs.free();
 	xr_view = {};
+	xr_systems.free();
 	xr_extensions.extensions.free();
 	xr_extensions.layers    .free();
+	xr_extensions.rejected  .free();
 	xr_extensions = {};
 	xr_runtime_name = "No runtime set";
+	xr_timings      = {};
 
 	xr_table_strings.each(free);
 	xr_table_strings.free();
-	xr_tables.each([](display_table_t &t) {for (int32_t i=0; i<t.column_count; i++) t.cols[i].free(); });
+	xr_tables.each([](display_table_t &t) {for (int32_t i=0; i<t.column_count; i++) t.cols[i].free(); free(t.cell_text); });
 	xr_tables.free();
+	xr_tables_group_end = 0;
+	memset(xr_tag_loaded,    0, sizeof(xr_tag_loaded));
+	memset(xr_tag_requested, 0, sizeof(xr_tag_requested));
 
+	// Samplers use the session from their own thread
+	metrics_stop();
+	events_stop();
 	if (xr_session)  xrDestroySession (xr_session);
+	paths_clear();
+	dispatch_clear();
+	actions_release_profiles();
 	if (xr_instance) xrDestroyInstance(xr_instance);
 
 	xr_session      = XR_NULL_HANDLE;
@@ -109,27 +291,56 @@ void openxr_info_release() {
 ///////////////////////////////////////////
 
 const char *openxr_result_string(XrResult result) {
-	switch (result) {
-#define ENTRY(NAME, VALUE) \
-	case VALUE: return #NAME;
-		XR_LIST_ENUM_XrResult(ENTRY)
-#undef ENTRY
-	default: return "<UNKNOWN>";
-	}
+	const char *name = enums_name(result);
+	return name ? name : "<UNKNOWN>";
 }
 
 ///////////////////////////////////////////
 
-const char* openxr_path_string(XrPath path) {
-	uint32_t count  = 0;
-	XrResult result = xrPathToString(xr_instance, path, 0, &count, nullptr);
-	if (XR_FAILED(result)) return openxr_result_string(result);
+void openxr_capture(const char *func, uint64_t key, XrResult result, const void *items, uint32_t item_size, uint32_t item_count) {
+	if (xr_capture == nullptr) return;
+	snapshot_writer_add(xr_capture, func, key, result, items, item_size, item_count);
+}
 
-	char* path_str = (char*)malloc(count + 1);
-	result = xrPathToString(xr_instance, path, count, &count, path_str);
-	if (XR_FAILED(result)) return openxr_result_string(result);
+///////////////////////////////////////////
 
-	return path_str;
+bool openxr_exe_path(char *out_path, size_t path_size) {
+#if defined(_WIN32)
+	DWORD length = GetModuleFileNameA(nullptr, out_path, (DWORD)path_size);
+	return length > 0 && length < path_size;
+#else
+	ssize_t length = readlink("/proc/self/exe", out_path, path_size-1);
+	if (length < 0) return false;
+	out_path[length] = '\0';
+	return true;
+#endif
+}
+
+///////////////////////////////////////////
+
+bool openxr_replay(const char *file) {
+	// The stub runtime's manifest is built next to the explorer executable
+	char   path[1024] = {};
+	size_t length     = openxr_exe_path(path, sizeof(path)) ? strlen(path) : 0;
+	while (length > 0 && path[length-1] != '\\' && path[length-1] != '/') length--;
+	snprintf(&path[length], sizeof(path) - length, "xrstubruntime.json");
+
+	FILE *fp = fopen(path, "r");
+	if (fp == nullptr) {
+		printf("Can't replay, stub runtime manifest not found at %s!\n", path);
+		return false;
+	}
+	fclose(fp);
+
+	// The loader picks these up the next time an instance is created
+#if defined(_WIN32)
+	_putenv_s("XR_RUNTIME_JSON",  path);
+	_putenv_s("XR_STUB_SNAPSHOT", file);
+#else
+	setenv("XR_RUNTIME_JSON",  path, 1);
+	setenv("XR_STUB_SNAPSHOT", file, 1);
+#endif
+	return true;
 }
 
 ///////////////////////////////////////////
@@ -145,7 +356,9 @@ const char *new_string(const char *format, ...) {
 		va_start(args, format);
 		vsnprintf(result, len+1, format, args);
 		va_end(args);
+		xr_table_strings_lock.lock();
 		xr_table_strings.add(result);
+		xr_table_strings_lock.unlock();
 		return result;
 	} else {
 		return "";
@@ -154,6 +367,30 @@ const char *new_string(const char *format, ...) {
 
 ///////////////////////////////////////////
 
+XrResult openxr_create_instance(const char **ext_names, uint32_t ext_count, XrInstance *out_instance) {
+	XrInstanceCreateInfo create_info = { XR_TYPE_INSTANCE_CREATE_INFO };
+	create_info.enabledExtensionCount = ext_count;
+	create_info.enabledExtensionNames = ext_names;
+	create_info.enabledApiLayerCount  = 0;
+	create_info.enabledApiLayerNames  = nullptr;
+	create_info.applicationInfo.applicationVersion = 1;
+	create_info.applicationInfo.engineVersion      = 1;
+	create_info.applicationInfo.apiVersion         = XR_CURRENT_API_VERSION;
+	snprintf(create_info.applicationInfo.applicationName, sizeof(create_info.applicationInfo.applicationName), "%s", "OpenXR Explorer");
+	snprintf(create_info.applicationInfo.engineName,      sizeof(create_info.applicationInfo.engineName     ), "None");
+	
+	XrResult result = xrCreateInstance(&create_info, out_instance);
+	openxr_capture("xrCreateInstance", create_info.applicationInfo.apiVersion, result, nullptr, 0, 0);
+	if (result == XR_ERROR_API_VERSION_UNSUPPORTED) {
+		create_info.applicationInfo.apiVersion = XR_API_VERSION_1_0;
+		result = xrCreateInstance(&create_info, out_instance);
+		openxr_capture("xrCreateInstance", create_info.applicationInfo.apiVersion, result, nullptr, 0, 0);
+	}
+	return result;
+}
+
+///////////////////////////////////////////
+
 void openxr_init_instance(array_t<XrExtensionProperties> extensions) {
 	if (xr_instance != XR_NULL_HANDLE || xr_instance_err != nullptr)
 		return;
@@ -172,26 +409,44 @@ void openxr_init_instance(array_t<XrExtensionProperties> extensions) {
 		exts.add(extensions[i].extensionName);
 	}
 
-	XrInstanceCreateInfo create_info = { XR_TYPE_INSTANCE_CREATE_INFO };
-	create_info.enabledExtensionCount = (uint32_t)exts.count;
-	create_info.enabledExtensionNames = exts.data;
-	create_info.enabledApiLayerCount  = 0;
-	create_info.enabledApiLayerNames  = nullptr;
-	create_info.applicationInfo.applicationVersion = 1;
-	create_info.applicationInfo.engineVersion      = 1;
-	create_info.applicationInfo.apiVersion         = XR_CURRENT_API_VERSION;
-	snprintf(create_info.applicationInfo.applicationName, sizeof(create_info.applicationInfo.applicationName), "%s", "OpenXR Explorer");
-	snprintf(create_info.applicationInfo.engineName,      sizeof(create_info.applicationInfo.engineName     ), "None");
-	
-	XrResult result = xrCreateInstance(&create_info, &xr_instance);
-	if (result == XR_ERROR_API_VERSION_UNSUPPORTED) {
-		create_info.applicationInfo.apiVersion = XR_API_VERSION_1_0;
-		result = xrCreateInstance(&create_info, &xr_instance);
+	uint64_t start  = stm_now();
+	XrResult result = openxr_create_instance(exts.data, (uint32_t)exts.count, &xr_instance);
+
+	// Some runtimes reject particular extensions, or combinations of them.
+	// Rather than show nothing, hunt down the culprits and leave them out.
+	if (XR_FAILED(result) && result != XR_ERROR_RUNTIME_UNAVAILABLE && exts.count > 0) {
+		array_t<const char *> accepted = {};
+		if (openxr_bisect_extensions(exts, &accepted, &xr_extensions.rejected))
+			result = openxr_create_instance(accepted.data, (uint32_t)accepted.count, &xr_instance);
+		accepted.free();
 	}
+	exts.free();
+	xr_timings.instance = stm_since(start);
+
 	if (XR_FAILED(result)) {
 		xr_instance_err = openxr_result_string(result);
 		xr_system_err   = "No XrInstance available";
 		xr_session_err  = "No XrInstance available";
+		return;
+	}
+	dispatch_load(xr_instance);
+	actions_probe_profiles();
+
+	if (xr_extensions.rejected.count > 0) {
+		display_table_t table = {};
+		table.name_func = "xrCreateInstance";
+		table.name_type = "XrInstanceCreateInfo";
+		table.spec      = "xrCreateInstance";
+		table.tag       = display_tag_features;
+		table.column_count = 2;
+		table.header_row   = true;
+		table.cols[0].add({ "Rejected Extension" });
+		table.cols[1].add({ "Spec", "Spec" });
+		for (size_t i = 0; i < xr_extensions.rejected.count; i++) {
+			table.cols[0].add({xr_extensions.rejected[i]});
+			table.cols[1].add({nullptr, xr_extensions.rejected[i]});
+		}
+		xr_tables.add(table);
 	}
 }
 
@@ -206,12 +461,85 @@ void openxr_init_system(XrFormFactor form) {
 	if (xr_system_id != XR_NULL_SYSTEM_ID || xr_system_err != nullptr) 
 		return;
 
-	XrSystemGetInfo system_info = { XR_TYPE_SYSTEM_GET_INFO };
-	system_info.formFactor = form;
-	XrResult result = xrGetSystem(xr_instance, &system_info, &xr_system_id);
-	if (XR_FAILED(result)) {
-		xr_system_err = openxr_result_string(result);
+	// Devices don't always come in the form factor we'd expect, so ask for
+	// every one of them. Each that's available gets its own set of tables.
+	struct form_name_t { XrFormFactor form; const char *name; };
+	const form_name_t forms[] = {
+#define CASE_GET_NAME(e, val) { e, #e },
+		XR_LIST_ENUM_XrFormFactor(CASE_GET_NAME)
+#undef CASE_GET_NAME
+	};
+
+	const char *form_err = "No XrSystemId available";
+	uint64_t    start    = stm_now();
+	for (size_t i = 0; i < sizeof(forms)/sizeof(forms[0]); i++) {
+		if (forms[i].form == XR_FORM_FACTOR_MAX_ENUM) continue;
+
+		xr_system_info_t system      = { forms[i].form, forms[i].name };
+		XrSystemGetInfo  system_info = { XR_TYPE_SYSTEM_GET_INFO };
+		system_info.formFactor = forms[i].form;
+		XrResult result = xrGetSystem(xr_instance, &system_info, &system.id);
+		openxr_capture("xrGetSystem", forms[i].form, result, nullptr, 0, 0);
+		if (XR_SUCCEEDED(result))    xr_systems.add(system);
+		else if (forms[i].form == form) form_err = openxr_result_string(result);
+	}
+	xr_timings.system = stm_since(start);
+
+	if (xr_systems.count == 0) {
+		xr_system_err  = form_err;
 		xr_session_err = "No XrSystemId available";
+		return;
+	}
+
+	// Stick with the requested form factor if it's there
+	xr_settings.form = xr_systems[0].form;
+	xr_system_id     = xr_systems[0].id;
+	for (size_t i = 0; i < xr_systems.count; i++) {
+		if (xr_systems[i].form != form) continue;
+		xr_settings.form = xr_systems[i].form;
+		xr_system_id     = xr_systems[i].id;
+	}
+}
+
+///////////////////////////////////////////
+
+void openxr_select_system(XrFormFactor form) {
+	if (form == xr_settings.form) return;
+
+	for (size_t i = 0; i < xr_systems.count; i++) {
+		if (xr_systems[i].form != form) continue;
+		xr_settings.form = form;
+		xr_system_id     = xr_systems[i].id;
+
+		// System and view tables are already loaded for every system, but
+		// the session, and anything that came from it or the old system,
+		// needs doing again.
+		metrics_stop();
+		live_release();
+		events_stop();
+		if (xr_session) {
+			xrDestroySession(xr_session);
+			xr_session = XR_NULL_HANDLE;
+		}
+		xr_session_err = nullptr;
+		for (size_t t = xr_tables_group_end; t < xr_tables.count; t++) {
+			const xr_enum_info_t *info = &xr_misc_enums[xr_tables[t].misc_enum];
+			if (xr_tables[t].pending || !(info->requires_system || info->requires_session)) continue;
+			for (int32_t c = 0; c < xr_tables[t].column_count; c++)
+				xr_tables[t].cols[c].clear();
+			xr_tables[t].error   = nullptr;
+			xr_tables[t].pending = true;
+		}
+
+		// Keep the view configuration if this system has it too
+		XrViewConfigurationType view_config = (XrViewConfigurationType)0;
+		for (size_t c = 0; c < xr_view.configs.count; c++) {
+			if (xr_view.configs[c].form != form) continue;
+			if (view_config == 0 || xr_view.configs[c].type == xr_view.current_config)
+				view_config = xr_view.configs[c].type;
+		}
+		openxr_select_view(view_config);
+		return;
 	}
 }
 
@@ -229,6 +557,21 @@ void openxr_init_session() {
 	if (xr_session != XR_NULL_HANDLE || xr_session_err != nullptr)
 		return;
 
+	// If the headless extension is present, we don't need a graphics binding!
+	bool headless = openxr_has_ext("XR_MND_headless");
+
+	// Graphics are slow to start, and can fail outright on machines without
+	// a display, so they're put off until a session actually needs them.
+	if (!headless && xr_settings.init_graphics) {
+		uint64_t start = stm_now();
+		bool     ready = xr_settings.init_graphics();
+		xr_timings.graphics = stm_since(start);
+		if (!ready) {
+			xr_session_err = "Failed to initialize graphics";
+			return;
+		}
+	}
+
 	skg_platform_data_t platform = skg_get_platform_data();
 #if defined(SKG_OPENGL) && defined(__linux__)
 	PFN_xrGetOpenGLGraphicsRequirementsKHR ext_xrGetOpenGLGraphicsRequirementsKHR;
@@ -239,8 +582,12 @@ void openxr_init_session() {
 	gfx_binding.glxFBConfig = (GLXFBConfig)platform._glx_fb_config;
 	gfx_binding.glxDrawable = (GLXDrawable)platform._glx_drawable;
 	gfx_binding.glxContext  = (GLXContext )platform._glx_context;
-	xrGetInstanceProcAddr(xr_instance, "xrGetOpenGLGraphicsRequirementsKHR", (PFN_xrVoidFunction *)(&ext_xrGetOpenGLGraphicsRequirementsKHR));
-	ext_xrGetOpenGLGraphicsRequirementsKHR(xr_instance, xr_system_id, &requirement);
+	XrResult req_result = xrGetInstanceProcAddr(xr_instance, "xrGetOpenGLGraphicsRequirementsKHR", (PFN_xrVoidFunction *)(&ext_xrGetOpenGLGraphicsRequirementsKHR));
+	openxr_capture("xrGetInstanceProcAddr", 0, req_result, nullptr, 0, 0);
+	if (XR_SUCCEEDED(req_result)) {
+		req_result = ext_xrGetOpenGLGraphicsRequirementsKHR(xr_instance, xr_system_id, &requirement);
+		openxr_capture("xrGetOpenGLGraphicsRequirementsKHR", 0, req_result, &requirement, sizeof(requirement), 1);
+	}
 #elif defined(SKG_OPENGL) && defined(_WIN32)
 	XrGraphicsBindingOpenGLKHR gfx_binding = { XR_TYPE_GRAPHICS_BINDING_OPENGL_KHR };
 	gfx_binding.hDC   = (HDC  )platform._gl_hdc;
@@ -249,8 +596,12 @@ void openxr_init_session() {
 	PFN_xrGetD3D11GraphicsRequirementsKHR ext_xrGetD3D11GraphicsRequirementsKHR;
 	XrGraphicsRequirementsD3D11KHR        requirement = { XR_TYPE_GRAPHICS_REQUIREMENTS_D3D11_KHR };
 	XrGraphicsBindingD3D11KHR             gfx_binding = { XR_TYPE_GRAPHICS_BINDING_D3D11_KHR };
-	xrGetInstanceProcAddr(xr_instance, "xrGetD3D11GraphicsRequirementsKHR", (PFN_xrVoidFunction *)(&ext_xrGetD3D11GraphicsRequirementsKHR));
-	ext_xrGetD3D11GraphicsRequirementsKHR(xr_instance, xr_system_id, &requirement);
+	XrResult req_result = xrGetInstanceProcAddr(xr_instance, "xrGetD3D11GraphicsRequirementsKHR", (PFN_xrVoidFunction *)(&ext_xrGetD3D11GraphicsRequirementsKHR));
+	openxr_capture("xrGetInstanceProcAddr", 0, req_result, nullptr, 0, 0);
+	if (XR_SUCCEEDED(req_result)) {
+		req_result = ext_xrGetD3D11GraphicsRequirementsKHR(xr_instance, xr_system_id, &requirement);
+		openxr_capture("xrGetD3D11GraphicsRequirementsKHR", 0, req_result, &requirement, sizeof(requirement), 1);
+	}
 	gfx_binding.device = (ID3D11Device*)platform._d3d11_device;
 #endif
 
@@ -258,14 +609,21 @@ void openxr_init_session() {
 	session_info.next     = &gfx_binding;
 	session_info.systemId = xr_system_id;
 
-	// If the headless extension is present, we don't need a graphics binding!
-	if (openxr_has_ext("XR_MND_headless"))
+	if (headless)
 		session_info.next = nullptr;
 
+	uint64_t start  = stm_now();
 	XrResult result = xrCreateSession(xr_instance, &session_info, &xr_session);
+	xr_timings.session = stm_since(start);
+	openxr_capture("xrCreateSession", 0, result, nullptr, 0, 0);
 	if (XR_FAILED(result)) {
 		xr_session_err = openxr_result_string(result);
+		return;
 	}
+
+	// Nothing else polls events, so this is also what keeps track of the
+	// session's state.
+	events_start(start);
 }
 
 ///////////////////////////////////////////
@@ -282,6 +640,7 @@ xr_extensions_t openxr_load_exts() {
 		return result;
 	result.layers = array_t<XrApiLayerProperties>::make_fill(count, {XR_TYPE_API_LAYER_PROPERTIES});
 	xrEnumerateApiLayerProperties(count, &count, result.layers.data);
+	openxr_capture("xrEnumerateApiLayerProperties", 0, XR_SUCCESS, result.layers.data, sizeof(XrApiLayerProperties), count);
 
 	display_table_t table = {};
 	table.name_func = "xrEnumerateApiLayerProperties";
@@ -310,6 +669,7 @@ xr_extensions_t openxr_load_exts() {
 		return result;
 	result.extensions = array_t<XrExtensionProperties>::make_fill(count, {XR_TYPE_EXTENSION_PROPERTIES});
 	xrEnumerateInstanceExtensionProperties(nullptr, count, &count, result.extensions.data);
+	openxr_capture("xrEnumerateInstanceExtensionProperties", 0, XR_SUCCESS, result.extensions.data, sizeof(XrExtensionProperties), count);
 	result.extensions.sort([](const XrExtensionProperties &a, const XrExtensionProperties &b) {
 		return strcmp(a.extensionName, b.extensionName);
 	});
@@ -337,6 +697,11 @@ xr_extensions_t openxr_load_exts() {
 ///////////////////////////////////////////
 
 bool openxr_has_ext(const char *ext_name){
+	// Extensions that broke xrCreateInstance weren't enabled
+	for (int32_t i = 0; i < xr_extensions.rejected.count; i++) {
+		if (strcmp(ext_name, xr_extensions.rejected[i]) == 0)
+		return false;
+	}
 	for (int32_t i = 0; i < xr_extensions.extensions.count ; i++) {
 		if (strcmp(ext_name, xr_extensions.extensions[i].extensionName) == 0)
 		return true;
@@ -361,6 +726,7 @@ xr_properties_t openxr_load_properties() {
 	if (!xr_instance_err) {
 		result.instance = { XR_TYPE_INSTANCE_PROPERTIES };
 		XrResult error = xrGetInstanceProperties(xr_instance, &result.instance);
+		openxr_capture("xrGetInstanceProperties", 0, error, &result.instance, sizeof(result.instance), 1);
 		if (XR_FAILED(error)) {
 			table.error = openxr_result_string(error);
 		} else {
@@ -378,7 +744,14 @@ xr_properties_t openxr_load_properties() {
 
 	//// System properties ////
 	
-	openxr_load_system_properties(xr_instance, xr_system_id);
+	if (xr_systems.count == 0)
+		openxr_load_system_properties(xr_instance, xr_system_id, xr_settings.form);
+	for (size_t i = 0; i < xr_systems.count; i++) {
+		size_t first = xr_tables.count;
+		openxr_load_system_properties(xr_instance, xr_systems[i].id, xr_systems[i].form);
+		for (size_t t = first; t < xr_tables.count; t++)
+			xr_tables[t].form = xr_systems[i].form;
+	}
 
 	return result;
 }
@@ -388,131 +761,397 @@ xr_properties_t openxr_load_properties() {
 xr_view_info_t openxr_load_view(XrViewConfigurationType view_config) {
 	xr_view_info_t result = {};
 
-	if (!xr_instance_err && ! xr_system_err) {
-		// Get the list of available configurations
-		uint32_t count = 0;
-		xrEnumerateViewConfigurations(xr_instance, xr_system_id, 0, &count, nullptr);
-		result.available_configs = array_t<XrViewConfigurationType>::make_fill(count, (XrViewConfigurationType)0);
-		xrEnumerateViewConfigurations(xr_instance, xr_system_id, count, &count, result.available_configs.data);
-		result.available_config_names.resize(count);
-		for (size_t i = 0; i < count; i++) {
-			switch (result.available_configs[i]) {
-#define CASE_GET_NAME(e, val) case e: result.available_config_names.add( #e ); break;
-				XR_LIST_ENUM_XrViewConfigurationType(CASE_GET_NAME)
-#undef CASE_GET_NAME
-			}
+	if (xr_instance_err || xr_system_err) {
+		const char *error = xr_instance_err ? "No XrInstance available" : "No XrSystemId available";
+		const char *names[][3] = {
+			{ "xrGetViewConfigurationProperties",  "XrViewConfigurationProperties", "XrViewConfigurationProperties" },
+			{ "xrEnumerateViewConfigurationViews", "XrViewConfigurationView",       "XrViewConfigurationView"       },
+			{ "xrEnumerateEnvironmentBlendModes",  "XrEnvironmentBlendMode",        "XrEnvironmentBlendMode"        },
+			{ "xrEnumerateReprojectionModesMSFT",  "XrReprojectionModeMSFT",        "XrReprojectionModeMSFT"        }, };
+		for (size_t i = 0; i < sizeof(names)/sizeof(names[0]); i++) {
+			display_table_t table = {};
+			table.name_func = names[i][0];
+			table.name_type = names[i][1];
+			table.spec      = names[i][2];
+			table.tag       = display_tag_view;
+			table.error     = error;
+			table.column_count = i < 2 ? 2 : 1;
+			xr_tables.add(table);
 		}
+		return result;
 	}
 
-	// If the caller didn't select a view config, then we'll use the default
-	result.current_config = view_config == 0 && result.available_configs.count > 0
-		? result.available_configs[0]
-		: view_config;
-
-	display_table_t table = {};
-	table.name_func = "xrGetViewConfigurationProperties";
-	table.name_type = "XrViewConfigurationProperties";
-	table.spec      = "XrViewConfigurationProperties";
-	table.tag       = display_tag_view;
-	table.column_count = 2;
+	// Get the list of available configurations, for every system
+	for (size_t s = 0; s < xr_systems.count; s++) {
+		uint32_t count = 0;
+		xrEnumerateViewConfigurations(xr_instance, xr_systems[s].id, 0, &count, nullptr);
+		array_t<XrViewConfigurationType> types = array_t<XrViewConfigurationType>::make_fill(count, (XrViewConfigurationType)0);
+		xrEnumerateViewConfigurations(xr_instance, xr_systems[s].id, count, &count, types.data);
+		openxr_capture("xrEnumerateViewConfigurations", snapshot_system_key(xr_systems[s].form, 0), XR_SUCCESS, types.data, sizeof(XrViewConfigurationType), count);
 
-	if (!xr_instance_err && !xr_system_err) {
-		result.config_properties = { XR_TYPE_VIEW_CONFIGURATION_PROPERTIES };
-		XrResult error = xrGetViewConfigurationProperties(xr_instance, xr_system_id, result.current_config, &result.config_properties);
-		if (XR_FAILED(error)) {
-			table.error = openxr_result_string(error);
-		} else {
-			table.cols[0].add({"fovMutable"}); table.cols[1].add({new_string("%s", result.config_properties.fovMutable ? "True" : "False")});
+		for (size_t i = 0; i < count; i++) {
+			xr_view_config_info_t config = {};
+			config.form      = xr_systems[s].form;
+			config.system_id = xr_systems[s].id;
+			config.type      = types[i];
+			config.name      = enums_name(types[i]);
+			if (config.name == nullptr) config.name = "Unknown";
+			result.configs.add(config);
 		}
-	} else {
-		if (xr_system_err)   table.error = "No XrSystemId available";
-		if (xr_instance_err) table.error = "No XrInstance available";
+		types.free();
 	}
-	xr_tables.add(table);
 
-	// Load view configuration
+	// If the caller didn't select a view config, or selected one that isn't
+	// here, then we'll use the current system's default
+	result.current_config = view_config;
+	bool found = false;
+	for (size_t i = 0; i < result.configs.count; i++) {
+		if (result.configs[i].form != xr_settings.form) continue;
+		if (!found || result.configs[i].type == view_config) result.current_config = result.configs[i].type;
+		found = true;
+	}
 
-	table = {};
-	table.name_func = "xrEnumerateViewConfigurationViews";
-	table.name_type = "XrViewConfigurationView";
-	table.spec      = "XrViewConfigurationView";
-	table.tag       = display_tag_view;
-	table.column_count = 2;
+	// Every configuration gets loaded up front, so switching between them
+	// later doesn't need a trip to the runtime. These are all read-only
+	// instance level queries, so they can run side by side.
+	struct view_job_t {
+		xr_view_config_info_t               *configs;
+		PFN_xrEnumerateReprojectionModesMSFT xrEnumerateReprojectionModesMSFT;
+	};
+	view_job_t job = { result.configs.data, xr_ext.xrEnumerateReprojectionModesMSFT };
+
+	openxr_parallel_for((int32_t)result.configs.count, xr_settings.serial, &job, [](void *data, int32_t i) {
+		view_job_t            *job    = (view_job_t *)data;
+		xr_view_config_info_t *config = &job->configs[i];
+		uint64_t               key    = snapshot_system_key(config->form, config->type);
+
+		config->properties = { XR_TYPE_VIEW_CONFIGURATION_PROPERTIES };
+		config->properties_result = xrGetViewConfigurationProperties(xr_instance, config->system_id, config->type, &config->properties);
+		openxr_capture("xrGetViewConfigurationProperties", key, config->properties_result, &config->properties, sizeof(config->properties), 1);
 
-	if (!xr_instance_err && !xr_system_err) {
 		uint32_t count = 0;
-		XrResult error = xrEnumerateViewConfigurationViews(xr_instance, xr_system_id, result.current_config, 0, &count, nullptr);
-		result.config_views = array_t<XrViewConfigurationView>::make_fill(count, { XR_TYPE_VIEW_CONFIGURATION_VIEW });
-		xrEnumerateViewConfigurationViews(xr_instance, xr_system_id, result.current_config, count, &count, result.config_views.data);
+		config->views_result = xrEnumerateViewConfigurationViews(xr_instance, config->system_id, config->type, 0, &count, nullptr);
+		config->views = array_t<XrViewConfigurationView>::make_fill(count, { XR_TYPE_VIEW_CONFIGURATION_VIEW });
+		xrEnumerateViewConfigurationViews(xr_instance, config->system_id, config->type, count, &count, config->views.data);
+		openxr_capture("xrEnumerateViewConfigurationViews", key, config->views_result, config->views.data, sizeof(XrViewConfigurationView), count);
+
+		count = 0;
+		config->blend_modes_result = xrEnumerateEnvironmentBlendModes(xr_instance, config->system_id, config->type, 0, &count, nullptr);
+		config->blend_modes = array_t<XrEnvironmentBlendMode>::make_fill(count, (XrEnvironmentBlendMode)0);
+		xrEnumerateEnvironmentBlendModes(xr_instance, config->system_id, config->type, count, &count, config->blend_modes.data);
+		openxr_capture("xrEnumerateEnvironmentBlendModes", key, config->blend_modes_result, config->blend_modes.data, sizeof(XrEnvironmentBlendMode), count);
+
+		count = 0;
+		config->reprojection_modes_result = XR_ERROR_FUNCTION_UNSUPPORTED;
+		if (job->xrEnumerateReprojectionModesMSFT) {
+			config->reprojection_modes_result = job->xrEnumerateReprojectionModesMSFT(xr_instance, config->system_id, config->type, 0, &count, nullptr);
+			config->reprojection_modes = array_t<XrReprojectionModeMSFT>::make_fill(count, (XrReprojectionModeMSFT)0);
+			job->xrEnumerateReprojectionModesMSFT(xr_instance, config->system_id, config->type, count, &count, config->reprojection_modes.data);
+			openxr_capture("xrEnumerateReprojectionModesMSFT", key, config->reprojection_modes_result, config->reprojection_modes.data, sizeof(XrReprojectionModeMSFT), count);
+		}
+	});
 
-		if (XR_FAILED(error)) {
-			table.error = openxr_result_string(error);
+	// Tables are built afterwards, in order, so they don't depend on timing
+	for (size_t c = 0; c < result.configs.count; c++) {
+		const xr_view_config_info_t *config = &result.configs[c];
+
+		display_table_t table = {};
+		table.name_func = "xrGetViewConfigurationProperties";
+		table.name_type = "XrViewConfigurationProperties";
+		table.spec      = "XrViewConfigurationProperties";
+		table.tag       = display_tag_view;
+		table.form         = config->form;
+		table.view_config  = config->type;
+		table.column_count = 2;
+		if (XR_FAILED(config->properties_result)) {
+			table.error = openxr_result_string(config->properties_result);
 		} else {
-			for (uint32_t i = 0; i < result.config_views.count; i++) {
+			table.cols[0].add({"fovMutable"}); table.cols[1].add({new_string("%s", config->properties.fovMutable ? "True" : "False")});
+		}
+		xr_tables.add(table);
+
+		table = {};
+		table.name_func = "xrEnumerateViewConfigurationViews";
+		table.name_type = "XrViewConfigurationView";
+		table.spec      = "XrViewConfigurationView";
+		table.tag       = display_tag_view;
+		table.form         = config->form;
+		table.view_config  = config->type;
+		table.column_count = 2;
+		if (XR_FAILED(config->views_result)) {
+			table.error = openxr_result_string(config->views_result);
+		} else {
+			for (uint32_t i = 0; i < config->views.count; i++) {
 				table.cols[0].add({new_string("View %u", i)         }); table.cols[1].add({""});
-				table.cols[0].add({"recommendedImageRectWidth"      }); table.cols[1].add({new_string("%u", result.config_views[i].recommendedImageRectWidth)});
-				table.cols[0].add({"recommendedImageRectHeight"     }); table.cols[1].add({new_string("%u", result.config_views[i].recommendedImageRectHeight)});
-				table.cols[0].add({"recommendedSwapchainSampleCount"}); table.cols[1].add({new_string("%u", result.config_views[i].recommendedSwapchainSampleCount)});
-				table.cols[0].add({"maxImageRectWidth"              }); table.cols[1].add({new_string("%u", result.config_views[i].maxImageRectWidth)});
-				table.cols[0].add({"maxImageRectHeight"             }); table.cols[1].add({new_string("%u", result.config_views[i].maxImageRectHeight)});
-				table.cols[0].add({"maxSwapchainSampleCount"        }); table.cols[1].add({new_string("%u", result.config_views[i].maxSwapchainSampleCount)});
+				table.cols[0].add({"recommendedImageRectWidth"      }); table.cols[1].add({new_string("%u", config->views[i].recommendedImageRectWidth)});
+				table.cols[0].add({"recommendedImageRectHeight"     }); table.cols[1].add({new_string("%u", config->views[i].recommendedImageRectHeight)});
+				table.cols[0].add({"recommendedSwapchainSampleCount"}); table.cols[1].add({new_string("%u", config->views[i].recommendedSwapchainSampleCount)});
+				table.cols[0].add({"maxImageRectWidth"              }); table.cols[1].add({new_string("%u", config->views[i].maxImageRectWidth)});
+				table.cols[0].add({"maxImageRectHeight"             }); table.cols[1].add({new_string("%u", config->views[i].maxImageRectHeight)});
+				table.cols[0].add({"maxSwapchainSampleCount"        }); table.cols[1].add({new_string("%u", config->views[i].maxSwapchainSampleCount)});
 			}
 		}
-	} else {
-		if (xr_system_err)   table.error = "No XrSystemId available";
-		if (xr_instance_err) table.error = "No XrInstance available";
+		xr_tables.add(table);
+
+		table = {};
+		table.name_func = "xrEnumerateEnvironmentBlendModes";
+		table.name_type = "XrEnvironmentBlendMode";
+		table.spec      = "XrEnvironmentBlendMode";
+		table.tag       = display_tag_view;
+		table.form         = config->form;
+		table.view_config  = config->type;
+		table.column_count = 1;
+		if (XR_FAILED(config->blend_modes_result)) {
+			table.error = openxr_result_string(config->blend_modes_result);
+		} else {
+			for (size_t i = 0; i < config->blend_modes.count; i++) {
+				const char *name = enums_name(config->blend_modes[i]);
+				if (name) table.cols[0].add({ name });
+			}
+		}
+		xr_tables.add(table);
+
+		table = {};
+		table.name_func = "xrEnumerateReprojectionModesMSFT";
+		table.name_type = "XrReprojectionModeMSFT";
+		table.spec      = "XrReprojectionModeMSFT";
+		table.tag       = display_tag_view;
+		table.form         = config->form;
+		table.view_config  = config->type;
+		table.column_count = 1;
+		if (XR_FAILED(config->reprojection_modes_result)) {
+			table.error = openxr_result_string(config->reprojection_modes_result);
+		} else {
+			for (size_t i = 0; i < config->reprojection_modes.count; i++) {
+				const char *name = enums_name(config->reprojection_modes[i]);
+				if (name) table.cols[0].add({ name });
+			}
+		}
+		xr_tables.add(table);
 	}
-	xr_tables.add(table);
 	return result;
 }
 
 ///////////////////////////////////////////
 
-void openxr_load_enums(xr_settings_t settings) {
-	// Check if any of the enums need a session
-	if (!xr_session_err && settings.allow_session) {
-		bool requires_session = false;
-		for (size_t i = 0; i < xr_misc_enums.count; i++) {
-			requires_session = requires_session || xr_misc_enums[i].requires_session;
-		}
-		if (requires_session) {
-			openxr_init_session();
-		}
-	} else if (!xr_session_err) {
-		xr_session_err = "Reload with Session enabled";
+void openxr_select_view(XrViewConfigurationType view_config) {
+	// Everything for every configuration is already loaded, this just
+	// changes which tables are current.
+	xr_settings.view_config = view_config;
+	xr_view.current_config  = view_config;
+}
+
+///////////////////////////////////////////
+
+XrResult openxr_get_visibility(PFN_xrGetVisibilityMaskKHR get_mask, XrViewConfigurationType view_config, uint32_t view, XrVisibilityMaskTypeKHR type, array_t<XrVector2f> *out_verts, array_t<uint32_t> *out_inds) {
+	XrVisibilityMaskKHR mask = { XR_TYPE_VISIBILITY_MASK_KHR };
+	XrResult result = get_mask(xr_session, view_config, view, type, &mask);
+	if (XR_SUCCEEDED(result)) {
+		*out_verts = array_t<XrVector2f>::make_fill(mask.vertexCountOutput, {});
+		*out_inds  = array_t<uint32_t>  ::make_fill(mask.indexCountOutput,  0);
+		mask.vertexCapacityInput = mask.vertexCountOutput;
+		mask.indexCapacityInput  = mask.indexCountOutput;
+		mask.vertices            = out_verts->data;
+		mask.indices             = out_inds ->data;
+		result = get_mask(xr_session, view_config, view, type, &mask);
+	}
+
+	// Two arrays come back from the one call, so they're stored as two
+	// records under the same key. Masks belong to the session's system.
+	uint64_t key = snapshot_system_key(xr_settings.form, ((uint64_t)view_config << 16) | ((uint64_t)view << 8) | (uint64_t)type);
+	openxr_capture("xrGetVisibilityMaskKHR",         key, result, out_verts->data, sizeof(XrVector2f), (uint32_t)out_verts->count);
+	openxr_capture("xrGetVisibilityMaskKHR.indices", key, result, out_inds ->data, sizeof(uint32_t),   (uint32_t)out_inds ->count);
+	return result;
+}
+
+///////////////////////////////////////////
+
+void openxr_free_visibility(array_t<xr_visibility_mask_t> *ref_masks) {
+	ref_masks->each([](xr_visibility_mask_t &m) {
+		m.hidden_verts .free();
+		m.hidden_inds  .free();
+		m.visible_verts.free();
+		m.visible_inds .free();
+	});
+	ref_masks->free();
+}
+
+///////////////////////////////////////////
+
+const char *openxr_format_name(int64_t native_format) {
+	switch (skg_tex_fmt_from_native(native_format)) {
+	case skg_tex_fmt_rgba32:        return "rgba32";
+	case skg_tex_fmt_rgba32_linear: return "rgba32 linear";
+	case skg_tex_fmt_bgra32:        return "bgra32";
+	case skg_tex_fmt_bgra32_linear: return "bgra32 linear";
+	case skg_tex_fmt_rg11b10:       return "rg11 b10";
+	case skg_tex_fmt_rgb10a2:       return "rgb10 a2";
+	case skg_tex_fmt_rgba64u:       return "rgba64u";
+	case skg_tex_fmt_rgba64s:       return "rgba64s";
+	case skg_tex_fmt_rgba64f:       return "rgba64f";
+	case skg_tex_fmt_rgba128:       return "rgba128";
+	case skg_tex_fmt_r8:            return "r8";
+	case skg_tex_fmt_r16:           return "r16";
+	case skg_tex_fmt_r32:           return "r32";
+	case skg_tex_fmt_depthstencil:  return "depth24 stencil8";
+	case skg_tex_fmt_depth32:       return "depth32";
+	case skg_tex_fmt_depth16:       return "depth16";
+	default:                        return new_string("Unknown 0x%x #%d", native_format, native_format);
 	}
+}
+
+///////////////////////////////////////////
 
+bool openxr_table_current(const display_table_t *table) {
+	return
+		(table->form        == 0 || table->form        == xr_settings.form) &&
+		(table->view_config == 0 || table->view_config == xr_view.current_config);
+}
+
+///////////////////////////////////////////
+
+void openxr_table_names(array_t<const char *> *out_funcs, array_t<const char *> *out_types) {
+	// Tables that aren't misc enums or properties structs
+	const char *fixed[][2] = {
+		{ "xrEnumerateApiLayerProperties",          "XrApiLayerProperties"          },
+		{ "xrEnumerateInstanceExtensionProperties", "XrExtensionProperties"         },
+		{ "xrCreateInstance",                       "XrInstanceCreateInfo"          },
+		{ "xrGetInstanceProperties",                "XrInstanceProperties"          },
+		{ "xrGetSystemProperties",                  "XrSystemProperties"            },
+		{ "xrGetViewConfigurationProperties",       "XrViewConfigurationProperties" },
+		{ "xrEnumerateViewConfigurationViews",      "XrViewConfigurationView"       },
+		{ "xrEnumerateEnvironmentBlendModes",       "XrEnvironmentBlendMode"        },
+		{ "xrEnumerateReprojectionModesMSFT",       "XrReprojectionModeMSFT"        }, };
+	auto add_func = [out_funcs](const char *name) {
+		if (name == nullptr) return;
+		for (size_t i = 0; i < out_funcs->count; i++) {
+			if (strcmp(out_funcs->data[i], name) == 0) return;
+		}
+		out_funcs->add(name);
+	};
+
+	for (size_t i = 0; i < sizeof(fixed)/sizeof(fixed[0]); i++) {
+		add_func(fixed[i][0]);
+		out_types->add(fixed[i][1]);
+	}
+	for (int32_t i = 0; openxr_properties_type(i) != nullptr; i++)
+		out_types->add(openxr_properties_type(i));
 	for (size_t i = 0; i < xr_misc_enums.count; i++) {
-		xr_misc_enums[i].items.clear();
+		add_func(xr_misc_enums[i].source_fn_name);
+		if (xr_misc_enums[i].source_type_name) out_types->add(xr_misc_enums[i].source_type_name);
+	}
+}
 
-		display_table_t table = {};
-		table.name_func = xr_misc_enums[i].source_fn_name;
-		table.name_type = xr_misc_enums[i].source_type_name;
-		table.spec      = xr_misc_enums[i].spec_link;
-		table.tag       = xr_misc_enums[i].tag;
-		table.column_count = 1;
+///////////////////////////////////////////
 
-		if ((!xr_misc_enums[i].requires_session  || !xr_session_err ) &&
-			(!xr_misc_enums[i].requires_instance || !xr_instance_err) &&
-			(!xr_misc_enums[i].requires_system   || !xr_system_err  )) {
+void openxr_load_requested() {
+	// Whole tags that windows asked for last frame
+	for (int32_t i = 0; i <= display_tag_misc; i++) {
+		if (xr_tag_requested[i]) openxr_load_tag((display_tag_)i);
+	}
 
-			XrResult error = xr_misc_enums[i].load_info(&xr_misc_enums[i], settings);
+	// Instance, system and session are shared, and not safe to set up from
+	// multiple threads, so sort those out first. This can add tables and
+	// shift the placeholders around, so indices are collected afterwards.
+	for (size_t i = 0; i < xr_tables.count; i++) {
+		if (!xr_tables[i].pending || !xr_tables[i].requested) continue;
+		const xr_enum_info_t *info = &xr_misc_enums[xr_tables[i].misc_enum];
+		if (info->requires_view    ) openxr_load_tag(display_tag_view);
+		if (info->requires_session ) openxr_require_session ();
+		if (info->requires_system  ) openxr_require_system  ();
+		if (info->requires_instance) openxr_require_instance();
+	}
 
-			for (size_t e = 0; e < xr_misc_enums[i].items.count; e++) {
-				table.cols[0].add({ xr_misc_enums[i].items[e] });
+	array_t<int32_t> requested = {};
+	for (size_t i = 0; i < xr_tables.count; i++) {
+		if (xr_tables[i].pending && xr_tables[i].requested)
+			requested.add(xr_tables[i].misc_enum);
+	}
+	if (requested.count == 0) return;
+
+	// Loaders only touch their own xr_enum_info_t, so they can all run at
+	// once. Results land in a slot per enum, and get copied into the tables
+	// afterwards, so the output doesn't depend on timing.
+	struct enum_job_t {
+		xr_settings_t settings;
+		int32_t      *enums;
+		XrResult     *results;
+		const char  **unavailable;
+	};
+	enum_job_t job = {};
+	job.settings    = xr_settings;
+	job.enums       = requested.data;
+	job.results     = (XrResult    *)malloc(sizeof(XrResult    ) * requested.count);
+	job.unavailable = (const char **)malloc(sizeof(const char *) * requested.count);
+
+	for (size_t i = 0; i < requested.count; i++) {
+		const xr_enum_info_t *info = &xr_misc_enums[requested[i]];
+		job.results    [i] = XR_SUCCESS;
+		job.unavailable[i] = nullptr;
+
+		if      (info->requires_instance && xr_instance_err) job.unavailable[i] = "No XrInstance available";
+		else if (info->requires_system   && xr_system_err  ) job.unavailable[i] = "No XrSystemId available";
+		else if (info->requires_session  && xr_session_err ) job.unavailable[i] = "No XrSession available";
+	}
+
+	openxr_parallel_for((int32_t)requested.count, xr_settings.serial, &job, [](void *data, int32_t i) {
+		enum_job_t     *job  = (enum_job_t *)data;
+		xr_enum_info_t *info = &xr_misc_enums[job->enums[i]];
+		info->items.clear();
+		records_clear(&info->records);
+		if (job->unavailable[i] == nullptr)
+			job->results[i] = info->load_info(info, job->settings);
+	});
+
+	for (size_t r = 0; r < requested.count; r++) {
+		const xr_enum_info_t *info  = &xr_misc_enums[requested[r]];
+		display_table_t      *table = nullptr;
+		for (size_t i = xr_tables_group_end; i < xr_tables.count; i++) {
+			if (xr_tables[i].misc_enum == requested[r]) { table = &xr_tables[i]; break; }
+		}
+
+		table->pending   = false;
+		table->requested = false;
+		if (job.unavailable[r] == nullptr) {
+			if (info->records.column_count > 0) {
+				records_to_table(&info->records, table);
+			} else {
+				for (size_t e = 0; e < info->items.count; e++) {
+					table->cols[e % table->column_count].add({ info->items[e] });
+				}
 			}
-			if (XR_FAILED(error)) {
-				table.error = openxr_result_string(error);
+			if (XR_FAILED(job.results[r])) {
+				table->error = openxr_result_string(job.results[r]);
 			}
 		} else {
-
-			if      (xr_misc_enums[i].requires_instance && xr_instance_err) table.error = "No XrInstance available";
-			else if (xr_misc_enums[i].requires_system   && xr_system_err  ) table.error = "No XrSystemId available";
-			else if (xr_misc_enums[i].requires_session  && xr_session_err ) table.error = "No XrSession available";
+			table->error = job.unavailable[r];
 		}
-
-		xr_tables.add(table);
 	}
+
+	free(job.results);
+	free(job.unavailable);
+	requested.free();
+}
+
+///////////////////////////////////////////
+
+void openxr_parallel_for(int32_t count, bool serial, void *data, void (*job)(void *data, int32_t index)) {
+	int32_t worker_count = serial ? 1 : (int32_t)std::thread::hardware_concurrency();
+	if (worker_count > xr_max_workers) worker_count = xr_max_workers;
+	if (worker_count > count)          worker_count = count;
+
+	// Each worker grabs the next job that nobody has started yet, so a slow
+	// call only holds up its own worker. The calling thread works too.
+	std::atomic<int32_t> next = { 0 };
+	auto work = [&]() {
+		for (int32_t i = next.fetch_add(1); i < count; i = next.fetch_add(1))
+			job(data, i);
+	};
+
+	std::thread workers[xr_max_workers];
+	for (int32_t i = 1; i < worker_count; i++) workers[i] = std::thread(work);
+	work();
+	for (int32_t i = 1; i < worker_count; i++) workers[i].join();
 }
 
 ///////////////////////////////////////////
@@ -530,46 +1169,53 @@ void openxr_register_enums() {
 		XrResult error = xrEnumerateReferenceSpaces(xr_session, 0, &count, nullptr);
 		array_t<XrReferenceSpaceType> items(count, (XrReferenceSpaceType)0);
 		xrEnumerateReferenceSpaces(xr_session, count, &count, items.data);
+		openxr_capture("xrEnumerateReferenceSpaces", 0, error, items.data, sizeof(XrReferenceSpaceType), count);
 		for (size_t i = 0; i < items.count; i++) {
-			switch (items[i]) {
-#define CASE_GET_NAME(e, val) case e: ref_info->items.add( #e ); break;
-				XR_LIST_ENUM_XrReferenceSpaceType(CASE_GET_NAME)
-#undef CASE_GET_NAME
-			}
+			const char *name = enums_name(items[i]);
+			if (name) ref_info->items.add(name);
 		}
 		items.free();
 		return error;
 	};
 	xr_misc_enums.add(info);
 
-	
-	info = { "xrEnumerateEnvironmentBlendModes" };
-	info.source_type_name = "XrEnvironmentBlendMode";
-	info.spec_link        = "XrEnvironmentBlendMode";
-	info.requires_instance= true;
-	info.requires_system  = true;
+	info = { "xrGetVisibilityMaskKHR" };
+	info.source_type_name = "XrVisibilityMaskKHR";
+	info.spec_link        = "XrVisibilityMaskKHR";
+	info.requires_session = true;
+	info.requires_view    = true;
 	info.tag              = display_tag_view;
 	info.load_info        = [](xr_enum_info_t *ref_info, xr_settings_t settings) {
-		if (settings.view_config == 0) {
-			if (xr_view.available_configs.count > 0) {
-				settings.view_config = xr_view.available_configs[0];
+		if (xr_ext.xrGetVisibilityMaskKHR == nullptr) return XR_ERROR_FUNCTION_UNSUPPORTED;
+
+		// Every view of every configuration the current system has, so the
+		// numbers can be compared without switching back and forth.
+		for (size_t c = 0; c < xr_view.configs.count; c++) {
+			xr_view_config_info_t *config = &xr_view.configs[c];
+			if (config->form != settings.form) continue;
+			openxr_free_visibility(&config->visibility_masks);
+
+			for (uint32_t v = 0; v < config->views.count; v++) {
+				xr_visibility_mask_t mask = {};
+				mask.view   = v;
+				mask.width  = config->views[v].recommendedImageRectWidth;
+				mask.height = config->views[v].recommendedImageRectHeight;
+				mask.result = openxr_get_visibility(xr_ext.xrGetVisibilityMaskKHR, config->type, v, XR_VISIBILITY_MASK_TYPE_HIDDEN_TRIANGLE_MESH_KHR, &mask.hidden_verts, &mask.hidden_inds);
+				if (XR_SUCCEEDED(mask.result))
+					mask.result = openxr_get_visibility(xr_ext.xrGetVisibilityMaskKHR, config->type, v, XR_VISIBILITY_MASK_TYPE_VISIBLE_TRIANGLE_MESH_KHR, &mask.visible_verts, &mask.visible_inds);
+
+				mask.hidden_fraction = XR_FAILED(mask.result) ? -1 : visibility_hidden_fraction(
+					mask.hidden_verts .data, (uint32_t)mask.hidden_verts .count, mask.hidden_inds .data, (uint32_t)mask.hidden_inds .count,
+					mask.visible_verts.data, (uint32_t)mask.visible_verts.count, mask.visible_inds.data, (uint32_t)mask.visible_inds.count,
+					mask.width, mask.height);
+
+				if      (XR_FAILED(mask.result))   ref_info->items.add(new_string("%s view %u: %s", config->name, v, openxr_result_string(mask.result)));
+				else if (mask.hidden_fraction < 0) ref_info->items.add(new_string("%s view %u: %ux%u, no mask", config->name, v, mask.width, mask.height));
+				else                               ref_info->items.add(new_string("%s view %u: %ux%u, %.1f%% hidden", config->name, v, mask.width, mask.height, mask.hidden_fraction * 100));
+				config->visibility_masks.add(mask);
 			}
 		}
-
-		uint32_t count = 0;
-		XrResult error = xrEnumerateEnvironmentBlendModes(xr_instance, xr_system_id, settings.view_config, 0, &count, nullptr);
-		array_t<XrEnvironmentBlendMode> items(count, (XrEnvironmentBlendMode)0);
-		xrEnumerateEnvironmentBlendModes(xr_instance, xr_system_id, settings.view_config, count, &count, items.data);
-
-		for (size_t i = 0; i < count; i++) {
-			switch (items[i]) {
-#define CASE_GET_NAME(e, val) case e: ref_info->items.add({ #e }); break;
-				XR_LIST_ENUM_XrEnvironmentBlendMode(CASE_GET_NAME)
-#undef CASE_GET_NAME
-			}
-		}
-		items.free();
-		return error;
+		return XR_SUCCESS;
 	};
 	xr_misc_enums.add(info);
 
@@ -583,29 +1229,85 @@ void openxr_register_enums() {
 		XrResult error = xrEnumerateSwapchainFormats(xr_session, 0, &count, nullptr);
 		array_t<int64_t> formats(count, 0);
 		xrEnumerateSwapchainFormats(xr_session, count, &count, formats.data);
+		openxr_capture("xrEnumerateSwapchainFormats", 0, error, formats.data, sizeof(int64_t), count);
 
 		for (size_t i = 0; i < formats.count; i++) {
-			skg_tex_fmt_ format = skg_tex_fmt_from_native(formats[i]);
-			switch (format) {
-			case skg_tex_fmt_none:          ref_info->items.add(new_string("Unknown 0x%x #%d", formats[i], formats[i])); break;
-			case skg_tex_fmt_rgba32:        ref_info->items.add("rgba32");          break;
-			case skg_tex_fmt_rgba32_linear: ref_info->items.add("rgba32 linear");   break;
-			case skg_tex_fmt_bgra32:        ref_info->items.add("bgra32");          break;
-			case skg_tex_fmt_bgra32_linear: ref_info->items.add("bgra32 linear");   break;
-			case skg_tex_fmt_rg11b10:       ref_info->items.add("rg11 b10");        break;
-			case skg_tex_fmt_rgb10a2:       ref_info->items.add("rgb10 a2");        break;
-			case skg_tex_fmt_rgba64u:       ref_info->items.add("rgba64u");         break;
-			case skg_tex_fmt_rgba64s:       ref_info->items.add("rgba64s");         break;
-			case skg_tex_fmt_rgba64f:       ref_info->items.add("rgba64f");         break;
-			case skg_tex_fmt_rgba128:       ref_info->items.add("rgba128");         break;
-			case skg_tex_fmt_r8:            ref_info->items.add("r8");              break;
-			case skg_tex_fmt_r16:           ref_info->items.add("r16");             break;
-			case skg_tex_fmt_r32:           ref_info->items.add("r32");             break;
-			case skg_tex_fmt_depthstencil:  ref_info->items.add("depth24 stencil8");break;
-			case skg_tex_fmt_depth32:       ref_info->items.add("depth32");         break;
-			case skg_tex_fmt_depth16:       ref_info->items.add("depth16");         break;
+			ref_info->items.add(openxr_format_name(formats[i]));
+		}
+		formats.free();
+		return error;
+	};
+	xr_misc_enums.add(info);
+
+	info = { nullptr };
+	info.source_type_name = "RenderThroughput";
+	info.requires_session = true;
+	info.requires_view    = true;
+	info.tag              = display_tag_view;
+	info.column_count     = 6;
+	info.load_info        = [](xr_enum_info_t *ref_info, xr_settings_t settings) {
+		uint32_t count = 0;
+		XrResult error = xrEnumerateSwapchainFormats(xr_session, 0, &count, nullptr);
+		array_t<int64_t> formats(count, 0);
+		xrEnumerateSwapchainFormats(xr_session, count, &count, formats.data);
+		openxr_capture("xrEnumerateSwapchainFormats", 0, error, formats.data, sizeof(int64_t), count);
+		if (XR_FAILED(error)) { formats.free(); return error; }
+
+		// Without the FB refresh rate extension there's no way to ask, so
+		// fall back to the rates headsets commonly run at, and say so.
+		array_t<float> refresh_rates = {};
+		bool           assumed       = false;
+		if (xr_ext.xrEnumerateDisplayRefreshRatesFB != nullptr) {
+			XrResult rate_error = xr_ext.xrEnumerateDisplayRefreshRatesFB(xr_session, 0, &count, nullptr);
+			refresh_rates = array_t<float>::make_fill(XR_SUCCEEDED(rate_error) ? count : 0, 0);
+			xr_ext.xrEnumerateDisplayRefreshRatesFB(xr_session, (uint32_t)refresh_rates.count, &count, refresh_rates.data);
+			openxr_capture("xrEnumerateDisplayRefreshRatesFB", 0, rate_error, refresh_rates.data, sizeof(float), (uint32_t)refresh_rates.count);
+		}
+		if (refresh_rates.count == 0) {
+			refresh_rates.add(72); refresh_rates.add(90); refresh_rates.add(120);
+			assumed = true;
+		}
+
+		ref_info->items.add("View Config");
+		ref_info->items.add("Format");
+		ref_info->items.add("Refresh (Hz)");
+		ref_info->items.add("Mpixels/s");
+		ref_info->items.add("MB/s");
+		ref_info->items.add("MB/s MSAA");
+
+		const char *prefix = "XR_VIEW_CONFIGURATION_TYPE_";
+		for (size_t c = 0; c < xr_view.configs.count; c++) {
+			const xr_view_config_info_t *config = &xr_view.configs[c];
+			if (config->form != settings.form || config->views.count == 0) continue;
+
+			// Everything is rendered at the recommended size. MSAA uses the
+			// runtime's recommended sample count, or 4x if it doesn't have
+			// an opinion, as far as the runtime allows.
+			double   pixels  = 0;
+			uint32_t samples = config->views[0].recommendedSwapchainSampleCount;
+			for (size_t v = 0; v < config->views.count; v++)
+				pixels += (double)config->views[v].recommendedImageRectWidth * config->views[v].recommendedImageRectHeight;
+			if (samples <= 1) samples = config->views[0].maxSwapchainSampleCount < 4 ? config->views[0].maxSwapchainSampleCount : 4;
+			if (samples <  1) samples = 1;
+
+			const char *config_name = strncmp(config->name, prefix, strlen(prefix)) == 0 ? config->name + strlen(prefix) : config->name;
+			for (size_t f = 0; f < formats.count; f++) {
+				skg_tex_fmt_ format = skg_tex_fmt_from_native(formats[f]);
+				if (format == skg_tex_fmt_none) continue;
+				double bytes = (double)skg_tex_fmt_size(format);
+
+				for (size_t r = 0; r < refresh_rates.count; r++) {
+					double per_second = pixels * refresh_rates[r];
+					ref_info->items.add(config_name);
+					ref_info->items.add(openxr_format_name(formats[f]));
+					ref_info->items.add(new_string(assumed ? "%g (assumed)" : "%g", refresh_rates[r]));
+					ref_info->items.add(new_string("%.1f", per_second / 1000000.0));
+					ref_info->items.add(new_string("%.1f", per_second * bytes / 1000000.0));
+					ref_info->items.add(new_string("%.1f (%ux)", per_second * bytes * samples / 1000000.0, samples));
+				}
 			}
 		}
+		refresh_rates.free();
 		formats.free();
 		return error;
 	};
@@ -618,21 +1320,17 @@ void openxr_register_enums() {
 	info.requires_instance= true;
 	info.tag              = display_tag_misc;
 	info.load_info        = [](xr_enum_info_t *ref_info, xr_settings_t settings) {
-		PFN_xrEnumerateColorSpacesFB xrEnumerateColorSpacesFB;
-		XrResult error = xrGetInstanceProcAddr(xr_instance, "xrEnumerateColorSpacesFB", (PFN_xrVoidFunction *)(&xrEnumerateColorSpacesFB));
-		if (XR_FAILED(error)) return error;
+		if (xr_ext.xrEnumerateColorSpacesFB == nullptr) return XR_ERROR_FUNCTION_UNSUPPORTED;
 
 		uint32_t count = 0;
-		error = xrEnumerateColorSpacesFB(xr_session, 0, &count, nullptr);
+		XrResult error = xr_ext.xrEnumerateColorSpacesFB(xr_session, 0, &count, nullptr);
 		array_t<XrColorSpaceFB> color_spaces(count, (XrColorSpaceFB)0);
-		xrEnumerateColorSpacesFB(xr_session, count, &count, color_spaces.data);
+		xr_ext.xrEnumerateColorSpacesFB(xr_session, count, &count, color_spaces.data);
+		openxr_capture("xrEnumerateColorSpacesFB", 0, error, color_spaces.data, sizeof(XrColorSpaceFB), count);
 
 		for (size_t i = 0; i < color_spaces.count; i++) {
-			switch (color_spaces[i]) {
-#define CASE_GET_NAME(e, val) case e: ref_info->items.add({ #e }); break;
-				XR_LIST_ENUM_XrColorSpaceFB(CASE_GET_NAME)
-#undef CASE_GET_NAME
-			}
+			const char *name = enums_name(color_spaces[i]);
+			if (name) ref_info->items.add({ name });
 		}
 		color_spaces.free();
 		return error;
@@ -646,14 +1344,13 @@ void openxr_register_enums() {
 	info.requires_instance= true;
 	info.tag              = display_tag_misc;
 	info.load_info        = [](xr_enum_info_t *ref_info, xr_settings_t settings) {
-		PFN_xrEnumerateDisplayRefreshRatesFB xrEnumerateDisplayRefreshRatesFB;
-		XrResult error = xrGetInstanceProcAddr(xr_instance, "xrEnumerateDisplayRefreshRatesFB", (PFN_xrVoidFunction *)(&xrEnumerateDisplayRefreshRatesFB));
-		if (XR_FAILED(error)) return error;
+		if (xr_ext.xrEnumerateDisplayRefreshRatesFB == nullptr) return XR_ERROR_FUNCTION_UNSUPPORTED;
 
 		uint32_t count = 0;
-		error = xrEnumerateDisplayRefreshRatesFB(xr_session, 0, &count, nullptr);
+		XrResult error = xr_ext.xrEnumerateDisplayRefreshRatesFB(xr_session, 0, &count, nullptr);
 		array_t<float> refresh_rates(count, 0);
-		xrEnumerateDisplayRefreshRatesFB(xr_session, count, &count, refresh_rates.data);
+		xr_ext.xrEnumerateDisplayRefreshRatesFB(xr_session, count, &count, refresh_rates.data);
+		openxr_capture("xrEnumerateDisplayRefreshRatesFB", 0, error, refresh_rates.data, sizeof(float), count);
 
 		for (size_t i = 0; i < refresh_rates.count; i++) {
 			ref_info->items.add({ new_string("%f", refresh_rates[i])});
@@ -669,18 +1366,18 @@ void openxr_register_enums() {
 	info.requires_session = true;
 	info.requires_instance= true;
 	info.tag              = display_tag_misc;
+	records_column(&info.records, "path", record_type_path);
 	info.load_info        = [](xr_enum_info_t *ref_info, xr_settings_t settings) {
-		PFN_xrEnumerateRenderModelPathsFB xrEnumerateRenderModelPathsFB;
-		XrResult error = xrGetInstanceProcAddr(xr_instance, "xrEnumerateRenderModelPathsFB", (PFN_xrVoidFunction *)(&xrEnumerateRenderModelPathsFB));
-		if (XR_FAILED(error)) return error;
+		if (xr_ext.xrEnumerateRenderModelPathsFB == nullptr) return XR_ERROR_FUNCTION_UNSUPPORTED;
 
 		uint32_t count = 0;
-		error = xrEnumerateRenderModelPathsFB(xr_session, 0, &count, nullptr);
+		XrResult error = xr_ext.xrEnumerateRenderModelPathsFB(xr_session, 0, &count, nullptr);
 		array_t<XrRenderModelPathInfoFB> model_paths(count, XrRenderModelPathInfoFB{ XR_TYPE_RENDER_MODEL_PATH_INFO_FB });
-		xrEnumerateRenderModelPathsFB(xr_session, count, &count, model_paths.data);
+		xr_ext.xrEnumerateRenderModelPathsFB(xr_session, count, &count, model_paths.data);
+		openxr_capture("xrEnumerateRenderModelPathsFB", 0, error, model_paths.data, sizeof(XrRenderModelPathInfoFB), count);
 
 		for (size_t i = 0; i < model_paths.count; i++) {
-			ref_info->items.add({ openxr_path_string(model_paths[i].path) });
+			records_add_path(&ref_info->records, model_paths[i].path);
 		}
 		model_paths.free();
 		return error;
@@ -692,21 +1389,20 @@ void openxr_register_enums() {
 	info.spec_link        = "XrViveTrackerPathsHTCX";
 	info.requires_instance= true;
 	info.tag              = display_tag_misc;
+	records_column(&info.records, "persistentPath", record_type_path);
+	records_column(&info.records, "rolePath",       record_type_path);
 	info.load_info        = [](xr_enum_info_t *ref_info, xr_settings_t settings) {
-		PFN_xrEnumerateViveTrackerPathsHTCX xrEnumerateViveTrackerPathsHTCX;
-		XrResult error = xrGetInstanceProcAddr(xr_instance, "xrEnumerateViveTrackerPathsHTCX", (PFN_xrVoidFunction *)(&xrEnumerateViveTrackerPathsHTCX));
-		if (XR_FAILED(error)) return error;
+		if (xr_ext.xrEnumerateViveTrackerPathsHTCX == nullptr) return XR_ERROR_FUNCTION_UNSUPPORTED;
 
 		uint32_t count = 0;
-		error = xrEnumerateViveTrackerPathsHTCX(xr_instance, 0, &count, nullptr);
+		XrResult error = xr_ext.xrEnumerateViveTrackerPathsHTCX(xr_instance, 0, &count, nullptr);
 		array_t<XrViveTrackerPathsHTCX> tracker_paths(count, XrViveTrackerPathsHTCX{ XR_TYPE_VIVE_TRACKER_PATHS_HTCX });
-		xrEnumerateViveTrackerPathsHTCX(xr_instance, count, &count, tracker_paths.data);
+		xr_ext.xrEnumerateViveTrackerPathsHTCX(xr_instance, count, &count, tracker_paths.data);
+		openxr_capture("xrEnumerateViveTrackerPathsHTCX", 0, error, tracker_paths.data, sizeof(XrViveTrackerPathsHTCX), count);
 
-		// TODO: This needs labels for persistentPath and rolePath, but the current
-		// structure doens't exactly allow for this.
 		for (size_t i = 0; i < tracker_paths.count; i++) {
-			ref_info->items.add({ openxr_path_string(tracker_paths[i].persistentPath) });
-			ref_info->items.add({ openxr_path_string(tracker_paths[i].rolePath) });
+			records_add_path(&ref_info->records, tracker_paths[i].persistentPath);
+			records_add_path(&ref_info->records, tracker_paths[i].rolePath);
 		}
 		tracker_paths.free();
 		return error;
@@ -719,48 +1415,33 @@ void openxr_register_enums() {
 	info.requires_instance= true;
 	info.tag              = display_tag_misc;
 	info.load_info        = [](xr_enum_info_t *ref_info, xr_settings_t settings) {
-		PFN_xrEnumeratePerformanceMetricsCounterPathsMETA xrEnumeratePerformanceMetricsCounterPathsMETA;
-		XrResult error = xrGetInstanceProcAddr(xr_instance, "xrEnumeratePerformanceMetricsCounterPathsMETA", (PFN_xrVoidFunction *)(&xrEnumeratePerformanceMetricsCounterPathsMETA));
-		if (XR_FAILED(error)) return error;
+		if (xr_ext.xrEnumeratePerformanceMetricsCounterPathsMETA == nullptr) return XR_ERROR_FUNCTION_UNSUPPORTED;
 
 		uint32_t count = 0;
-		error = xrEnumeratePerformanceMetricsCounterPathsMETA(xr_instance, 0, &count, nullptr);
+		XrResult error = xr_ext.xrEnumeratePerformanceMetricsCounterPathsMETA(xr_instance, 0, &count, nullptr);
 		array_t<XrPath> metric_paths(count, {});
-		xrEnumeratePerformanceMetricsCounterPathsMETA(xr_instance, count, &count, metric_paths.data);
+		xr_ext.xrEnumeratePerformanceMetricsCounterPathsMETA(xr_instance, count, &count, metric_paths.data);
+		openxr_capture("xrEnumeratePerformanceMetricsCounterPathsMETA", 0, error, metric_paths.data, sizeof(XrPath), count);
 
+		paths_resolve(metric_paths.data, (int32_t)metric_paths.count);
 		for (size_t i = 0; i < metric_paths.count; i++) {
-			ref_info->items.add({ openxr_path_string(metric_paths[i]) });
+			ref_info->items.add({ paths_to_string(metric_paths[i]) });
 		}
 		metric_paths.free();
 		return error;
 	};
 	xr_misc_enums.add(info);
 
-	info = { "xrEnumerateReprojectionModesMSFT" };
-	info.source_type_name = "XrReprojectionModeMSFT";
-	info.spec_link        = "XrReprojectionModeMSFT";
-	info.requires_system  = true;
+	info = { "xrSuggestInteractionProfileBindings" };
+	info.source_type_name = "XrInteractionProfileSuggestedBinding";
+	info.spec_link        = "semantic-path-interaction-profiles";
 	info.requires_instance= true;
-	info.tag              = display_tag_misc;
+	info.tag              = display_tag_input;
+	records_column(&info.records, "Interaction profile", record_type_string);
+	records_column(&info.records, "Result",              record_type_enum, [](int64_t value) { return openxr_result_string((XrResult)value); });
+	records_column(&info.records, "Bindings",            record_type_number);
 	info.load_info        = [](xr_enum_info_t *ref_info, xr_settings_t settings) {
-		PFN_xrEnumerateReprojectionModesMSFT xrEnumerateReprojectionModesMSFT;
-		XrResult error = xrGetInstanceProcAddr(xr_instance, "xrEnumerateReprojectionModesMSFT", (PFN_xrVoidFunction *)(&xrEnumerateReprojectionModesMSFT));
-		if (XR_FAILED(error)) return error;
-
-		uint32_t count = 0;
-		error = xrEnumerateReprojectionModesMSFT(xr_instance, xr_system_id, xr_view.current_config, 0, &count, nullptr);
-		array_t<XrReprojectionModeMSFT> reprojection_modes(count, (XrReprojectionModeMSFT)0);
-		xrEnumerateReprojectionModesMSFT(xr_instance, xr_system_id, xr_view.current_config, count, &count, reprojection_modes.data);
-
-		for (size_t i = 0; i < reprojection_modes.count; i++) {
-			switch (reprojection_modes[i]) {
-#define CASE_GET_NAME(e, val) case e: ref_info->items.add({ #e }); break;
-				XR_LIST_ENUM_XrReprojectionModeMSFT(CASE_GET_NAME)
-#undef CASE_GET_NAME
-			}
-		}
-		reprojection_modes.free();
-		return error;
+		return actions_load_profiles(&ref_info->records);
 	};
 	xr_misc_enums.add(info);
 
@@ -771,21 +1452,17 @@ void openxr_register_enums() {
 	info.requires_instance= true;
 	info.tag              = display_tag_misc;
 	info.load_info        = [](xr_enum_info_t *ref_info, xr_settings_t settings) {
-		PFN_xrEnumerateSceneComputeFeaturesMSFT xrEnumerateSceneComputeFeaturesMSFT;
-		XrResult error = xrGetInstanceProcAddr(xr_instance, "xrEnumerateSceneComputeFeaturesMSFT", (PFN_xrVoidFunction *)(&xrEnumerateSceneComputeFeaturesMSFT));
-		if (XR_FAILED(error)) return error;
+		if (xr_ext.xrEnumerateSceneComputeFeaturesMSFT == nullptr) return XR_ERROR_FUNCTION_UNSUPPORTED;
 
 		uint32_t count = 0;
-		error = xrEnumerateSceneComputeFeaturesMSFT(xr_instance, xr_system_id, 0, &count, nullptr);
+		XrResult error = xr_ext.xrEnumerateSceneComputeFeaturesMSFT(xr_instance, xr_system_id, 0, &count, nullptr);
 		array_t<XrSceneComputeFeatureMSFT> compute_features(count, (XrSceneComputeFeatureMSFT)0);
-		xrEnumerateSceneComputeFeaturesMSFT(xr_instance, xr_system_id, count, &count, compute_features.data);
+		xr_ext.xrEnumerateSceneComputeFeaturesMSFT(xr_instance, xr_system_id, count, &count, compute_features.data);
+		openxr_capture("xrEnumerateSceneComputeFeaturesMSFT", snapshot_system_key(xr_settings.form, 0), error, compute_features.data, sizeof(XrSceneComputeFeatureMSFT), count);
 
 		for (size_t i = 0; i < compute_features.count; i++) {
-			switch (compute_features[i]) {
-#define CASE_GET_NAME(e, val) case e: ref_info->items.add({ #e }); break;
-				XR_LIST_ENUM_XrSceneComputeFeatureMSFT(CASE_GET_NAME)
-#undef CASE_GET_NAME
-			}
+			const char *name = enums_name(compute_features[i]);
+			if (name) ref_info->items.add({ name });
 		}
 		compute_features.free();
 		return error;
@@ -23,7 +23,17 @@ enum display_tag_ {
 	display_tag_properties,
 	display_tag_features,
 	display_tag_view,
+	display_tag_input,
 	display_tag_misc,
+	display_tag_live,
+};
+
+enum record_type_ {
+	record_type_string,
+	record_type_path,
+	record_type_bool,
+	record_type_number,
+	record_type_enum,
 };
 
 struct display_item_t {
@@ -40,13 +50,60 @@ struct display_table_t {
 	bool                    header_row;
 	bool                    show_type;
 	int32_t                 column_count;
-	array_t<display_item_t> cols[3];
+	array_t<display_item_t> cols[6];
+	// What kind of value each column holds, for lining things up. Tables
+	// made from records also keep all their cell text in one block here.
+	record_type_            col_types[6];
+	char                   *cell_text;
+
+	// Misc enum tables start out pending, and are filled in the first time
+	// they're asked for, see openxr_load_requested.
+	bool                    pending;
+	bool                    requested;
+	int32_t                 misc_enum;
+
+	// Tables that only describe one system or view configuration say which
+	// one, and are 0 otherwise.
+	XrFormFactor            form;
+	XrViewConfigurationType view_config;
 };
 
 struct xr_settings_t {
 	XrViewConfigurationType view_config;
 	XrFormFactor            form;
 	bool                    allow_session;
+	bool                    serial;
+	const char             *capture_file;
+
+	// Called right before the first session that needs a graphics binding,
+	// for when graphics haven't been set up yet. Returns false on failure.
+	bool                  (*init_graphics)();
+};
+
+// In sokol_time ticks, 0 for anything that hasn't happened yet.
+struct xr_timings_t {
+	uint64_t loader;
+	uint64_t graphics;
+	uint64_t instance;
+	uint64_t system;
+	uint64_t session;
+};
+
+struct record_column_t {
+	const char   *header;
+	record_type_  type;
+	// Only for enum columns, turns a value into its name
+	const char *(*enum_name)(int64_t value);
+};
+
+// Rows of typed values, kept a column at a time. Cells are 64 bits each,
+// strings are packed into one buffer that cells point at by offset, and
+// paths stay XrPaths until the table is made. See openxr_records.h.
+struct xr_records_t {
+	int32_t           column_count;
+	record_column_t   columns[6];
+	array_t<uint64_t> values [6];
+	array_t<char>     text;
 };
 
 struct xr_enum_info_t {
@@ -57,8 +114,15 @@ struct xr_enum_info_t {
 	bool                  requires_instance;
 	bool                  requires_system;
 	bool                  requires_session;
+	bool                  requires_view;
 	display_tag_          tag;
+	// With more than one column, items fill the table a row at a time, and
+	// the first row is the header.
+	int32_t               column_count;
 	array_t<const char *> items;
+	// Enums with columns set up here fill these instead of items, and
+	// their columns and headers come from here.
+	xr_records_t          records;
 	XrResult            (*load_info)(xr_enum_info_t *ref_info, xr_settings_t settings);
 };
 
@@ -66,32 +130,111 @@ struct xr_properties_t {
 	XrInstanceProperties instance;
 };
 
+struct xr_system_info_t {
+	XrFormFactor form;
+	const char  *name;
+	XrSystemId   id;
+};
+
+struct xr_visibility_mask_t {
+	uint32_t            view;
+	uint32_t            width;
+	uint32_t            height;
+	XrResult            result;
+	array_t<XrVector2f> hidden_verts;
+	array_t<uint32_t>   hidden_inds;
+	array_t<XrVector2f> visible_verts;
+	array_t<uint32_t>   visible_inds;
+	float               hidden_fraction;
+};
+
+struct xr_view_config_info_t {
+	XrFormFactor                     form;
+	XrSystemId                       system_id;
+	XrViewConfigurationType          type;
+	const char                      *name;
+	XrViewConfigurationProperties    properties;
+	XrResult                         properties_result;
+	array_t<XrViewConfigurationView> views;
+	XrResult                         views_result;
+	array_t<XrEnvironmentBlendMode>  blend_modes;
+	XrResult                         blend_modes_result;
+	array_t<XrReprojectionModeMSFT>  reprojection_modes;
+	XrResult                         reprojection_modes_result;
+
+	// Needs a session, so this is filled in by the xrGetVisibilityMaskKHR
+	// misc enum, and only for the current system.
+	array_t<xr_visibility_mask_t>    visibility_masks;
+};
+
 struct xr_view_info_t {
-	XrViewConfigurationType          current_config;
-	array_t<XrViewConfigurationType> available_configs;
-	array_t<const char *>            available_config_names;
-	XrViewConfigurationProperties    config_properties;
-	array_t<XrViewConfigurationView> config_views;
+	XrViewConfigurationType        current_config;
+	array_t<xr_view_config_info_t> configs;
 };
 
 /*** Global Variables ********************/
 
 extern array_t<display_table_t> xr_tables;
 
-extern array_t<xr_enum_info_t> xr_misc_enums;
-extern xr_properties_t         xr_properties;
-extern xr_view_info_t          xr_view;
+extern array_t<xr_enum_info_t>   xr_misc_enums;
+extern array_t<xr_system_info_t> xr_systems;
+extern xr_properties_t           xr_properties;
+extern xr_view_info_t            xr_view;
 
+extern XrInstance  xr_instance;
+extern XrSession   xr_session;
+extern XrSystemId  xr_system_id;
 extern const char *xr_instance_err;
 extern const char *xr_session_err;
 extern const char *xr_system_err;
 
 extern const char* xr_runtime_name;
 
+// What the tables are loaded with. If the requested form factor isn't
+// available, or another system or view is selected, this is what changes.
+extern xr_settings_t xr_settings;
+
+extern xr_timings_t xr_timings;
+
 /*** Signatures **************************/
 
 void openxr_info_reload (xr_settings_t settings);
 void openxr_info_release();
 
+// Reloading only registers what tables exist, these load them on demand.
+// Results stick around until the next reload.
+void openxr_load_tag      (display_tag_ tag);
+// Loads the tag on the next openxr_load_requested instead of right away, for
+// when something might still be looking at xr_tables.
+void openxr_request_tag   (display_tag_ tag);
+bool openxr_load_next     ();
+void openxr_load_requested();
+void openxr_load_all      ();
+// Sets up the instance, system and session if they aren't already.
+void openxr_require_session();
+// For tables made outside of loading, like live test results. Returns the
+// table's new home in xr_tables.
+display_table_t *openxr_add_table(display_table_t table);
+
+// Switches which system or view configuration's tables are current,
+// without reloading.
+void openxr_select_system(XrFormFactor form);
+void openxr_select_view  (XrViewConfigurationType view_config);
+bool openxr_table_current(const display_table_t *table);
+// Every function and type there can be a table for, without loading
+// anything, for things like help text. Misc enums come from the last
+// openxr_info_reload. Functions are only listed once.
+void openxr_table_names  (array_t<const char *> *out_funcs, array_t<const char *> *out_types);
+
 const char *openxr_result_string(XrResult result);
-const char *new_string(const char *format, ...);
\ No newline at end of file
+// False for extensions the runtime doesn't have, or that were left out to
+// get xrCreateInstance working.
+bool        openxr_has_ext      (const char *ext_name);
+const char *openxr_format_name  (int64_t native_format);
+const char *new_string(const char *format, ...);
+
+XrResult openxr_create_instance(const char **ext_names, uint32_t ext_count, XrInstance *out_instance);
+bool     openxr_exe_path       (char *out_path, size_t path_size);
+
+bool openxr_replay (const char *file);
+void openxr_capture(const char *func, uint64_t key, XrResult result, const void *items, uint32_t item_size, uint32_t item_count);
\ No newline at end of file
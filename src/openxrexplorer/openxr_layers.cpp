@@ -0,0 +1,259 @@
+#include "openxr_layers.h"
+#include "openxr_live.h"
+
+#include <chrono>
+
+/*** Types *******************************/
+
+enum layers_type_ {
+	layers_type_quad,
+	layers_type_projection,
+	layers_type_max,
+};
+
+struct layers_step_t {
+	float       end_p50;
+	float       end_p99;
+	int32_t     frames;
+	int32_t     dropped;
+	const char *error;
+};
+
+/*** Global Variables ********************/
+
+// Quads are laid out in a grid in front of LOCAL, this many to a row
+const int32_t layers_grid      = 8;
+const float   layers_quad_size = 0.12f;
+const int32_t layers_max_views = 4;
+
+/*** Signatures **************************/
+
+layers_step_t layers_measure(float duration_sec, XrSpace space, const XrCompositionLayerBaseHeader *const *layers, uint32_t layer_count, XrCompositionLayerProjectionView *ref_views, uint32_t view_count, XrSwapchain swapchain);
+
+/*** Code ********************************/
+
+const char *layers_stress(float duration_sec, array_t<const char *> *ref_items) {
+	XrSystemProperties properties = { XR_TYPE_SYSTEM_PROPERTIES };
+	XrResult result = xrGetSystemProperties(xr_instance, xr_system_id, &properties);
+	if (XR_FAILED(result)) return openxr_result_string(result);
+	uint32_t max_layers = properties.graphicsProperties.maxLayerCount;
+	if (max_layers == 0) return "maxLayerCount is 0";
+
+	// Everything draws from one swapchain at the recommended size, since
+	// the swapchain's content isn't what's being measured.
+	const xr_view_config_info_t *config = nullptr;
+	for (size_t c = 0; c < xr_view.configs.count; c++) {
+		if (xr_view.configs[c].form == xr_settings.form && xr_view.configs[c].type == live_view_config)
+			config = &xr_view.configs[c];
+	}
+	if (config == nullptr || config->views.count == 0) return "No recommended view sizes";
+	uint32_t view_count = config->views.count < layers_max_views ? (uint32_t)config->views.count : layers_max_views;
+	int32_t  width      = config->views[0].recommendedImageRectWidth;
+	int32_t  height     = config->views[0].recommendedImageRectHeight;
+
+	uint32_t count = 0;
+	xrEnumerateSwapchainFormats(xr_session, 0, &count, nullptr);
+	array_t<int64_t> formats(count, 0);
+	xrEnumerateSwapchainFormats(xr_session, count, &count, formats.data);
+	int64_t format = 0;
+	for (size_t i = 0; i < formats.count; i++) {
+		skg_tex_fmt_ skg_format = skg_tex_fmt_from_native(formats[i]);
+		if (skg_format != skg_tex_fmt_depthstencil && skg_format != skg_tex_fmt_depth32 && skg_format != skg_tex_fmt_depth16) {
+			format = formats[i];
+			break;
+		}
+	}
+	formats.free();
+	if (format == 0) return "No color swapchain formats";
+
+	if (XR_FAILED(result = live_session_begin()))
+		return openxr_result_string(result);
+
+	XrSwapchainCreateInfo swapchain_info = { XR_TYPE_SWAPCHAIN_CREATE_INFO };
+	swapchain_info.usageFlags  = XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT | XR_SWAPCHAIN_USAGE_SAMPLED_BIT;
+	swapchain_info.format      = format;
+	swapchain_info.sampleCount = 1;
+	swapchain_info.width       = width;
+	swapchain_info.height      = height;
+	swapchain_info.faceCount   = 1;
+	swapchain_info.arraySize   = 1;
+	swapchain_info.mipCount    = 1;
+	XrSwapchain swapchain = XR_NULL_HANDLE;
+	if (XR_FAILED(result = xrCreateSwapchain(xr_session, &swapchain_info, &swapchain)))
+		return openxr_result_string(result);
+
+	XrReferenceSpaceCreateInfo space_info = { XR_TYPE_REFERENCE_SPACE_CREATE_INFO };
+	space_info.referenceSpaceType   = XR_REFERENCE_SPACE_TYPE_LOCAL;
+	space_info.poseInReferenceSpace = { {0,0,0,1}, {0,0,0} };
+	XrSpace space = XR_NULL_HANDLE;
+	if (XR_FAILED(result = xrCreateReferenceSpace(xr_session, &space_info, &space))) {
+		xrDestroySwapchain(swapchain);
+		return openxr_result_string(result);
+	}
+
+	XrCompositionLayerProjectionView views[layers_max_views];
+	for (uint32_t v = 0; v < view_count; v++) {
+		views[v] = { XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW };
+		views[v].subImage.swapchain        = swapchain;
+		views[v].subImage.imageRect.extent = { width, height };
+	}
+	int32_t quad_px = width < 256 ? width : 256;
+	array_t<XrCompositionLayerQuad>       quads       = {};
+	array_t<XrCompositionLayerProjection> projections = {};
+	for (uint32_t i = 0; i < max_layers; i++) {
+		// Every layer past the first blends, like UI on top of a scene would
+		XrCompositionLayerFlags flags = i == 0 ? 0 : XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT;
+
+		XrCompositionLayerQuad quad = { XR_TYPE_COMPOSITION_LAYER_QUAD };
+		quad.layerFlags = flags;
+		quad.space      = space;
+		quad.eyeVisibility              = XR_EYE_VISIBILITY_BOTH;
+		quad.subImage.swapchain         = swapchain;
+		quad.subImage.imageRect.extent  = { quad_px, quad_px };
+		quad.pose = { {0,0,0,1}, {
+			((i % layers_grid) - (layers_grid - 1) / 2.0f) * layers_quad_size * 1.25f,
+			(((i / layers_grid) % layers_grid) - (layers_grid - 1) / 2.0f) * layers_quad_size * 1.25f,
+			-1.5f } };
+		quad.size = { layers_quad_size, layers_quad_size };
+		quads.add(quad);
+
+		XrCompositionLayerProjection projection = { XR_TYPE_COMPOSITION_LAYER_PROJECTION };
+		projection.layerFlags = flags;
+		projection.space      = space;
+		projection.viewCount  = view_count;
+		projection.views      = views;
+		projections.add(projection);
+	}
+
+	ref_items->add("Layers");
+	ref_items->add("Quads: xrEndFrame p50/p99 (us)");
+	ref_items->add("Quads: dropped frames");
+	ref_items->add("Projections: xrEndFrame p50/p99 (us)");
+	ref_items->add("Projections: dropped frames");
+
+	array_t<layers_step_t>                      steps   = array_t<layers_step_t>::make_fill((int32_t)(max_layers * layers_type_max), {});
+	array_t<const XrCompositionLayerBaseHeader*> headers = {};
+	float step_sec = duration_sec / (max_layers * layers_type_max);
+	for (int32_t type = 0; type < layers_type_max && !live_cancelled(); type++) {
+		headers.clear();
+		for (uint32_t i = 0; i < max_layers; i++) {
+			headers.add(type == layers_type_quad
+				? (XrCompositionLayerBaseHeader *)&quads[i]
+				: (XrCompositionLayerBaseHeader *)&projections[i]);
+		}
+
+		// Once the runtime refuses a count, more won't go any better
+		const char *error = nullptr;
+		for (uint32_t n = 1; n <= max_layers && !live_cancelled(); n++) {
+			live_set_progress((float)(type * max_layers + n - 1) / (max_layers * layers_type_max));
+			layers_step_t *step = &steps[type * max_layers + (n - 1)];
+			if (error) { step->error = error; continue; }
+			*step = layers_measure(step_sec, space, headers.data, n, views, view_count, swapchain);
+			error = step->error;
+		}
+	}
+
+	for (uint32_t n = 1; n <= max_layers; n++) {
+		ref_items->add(new_string("%u", n));
+		for (int32_t type = 0; type < layers_type_max; type++) {
+			const layers_step_t *step = &steps[type * max_layers + (n - 1)];
+			if (step->error) {
+				ref_items->add(step->error);
+				ref_items->add("");
+			} else if (step->frames == 0) {
+				ref_items->add("Not measured");
+				ref_items->add("");
+			} else {
+				ref_items->add(new_string("%.1f / %.1f", step->end_p50, step->end_p99));
+				ref_items->add(new_string("%d of %d", step->dropped, step->frames + step->dropped));
+			}
+		}
+	}
+
+	// Layers have to stop pointing at the swapchain before it goes
+	XrFrameState state = { XR_TYPE_FRAME_STATE };
+	if (XR_SUCCEEDED(live_frame_begin(&state)))
+		live_frame_end(&state, nullptr, 0);
+
+	steps      .free();
+	headers    .free();
+	quads      .free();
+	projections.free();
+	xrDestroySpace    (space);
+	xrDestroySwapchain(swapchain);
+	return nullptr;
+}
+
+///////////////////////////////////////////
+
+layers_step_t layers_measure(float duration_sec, XrSpace space, const XrCompositionLayerBaseHeader *const *layers, uint32_t layer_count, XrCompositionLayerProjectionView *ref_views, uint32_t view_count, XrSwapchain swapchain) {
+	typedef std::chrono::steady_clock clock;
+
+	layers_step_t  step      = {};
+	array_t<float> end_times = {};
+	XrTime         prev_time = 0;
+	XrResult       result    = XR_SUCCESS;
+
+	clock::time_point start = clock::now();
+	while (std::chrono::duration<float>(clock::now() - start).count() < duration_sec && !live_cancelled()) {
+		XrFrameState state = { XR_TYPE_FRAME_STATE };
+		if (XR_FAILED(result = live_frame_begin(&state))) break;
+
+		// A gap of more than one display period is the runtime skipping
+		// frames we should have made.
+		if (prev_time != 0 && state.predictedDisplayPeriod > 0) {
+			XrDuration gap = state.predictedDisplayTime - prev_time;
+			if (gap > state.predictedDisplayPeriod * 3 / 2)
+				step.dropped += (int32_t)((gap + state.predictedDisplayPeriod / 2) / state.predictedDisplayPeriod) - 1;
+		}
+		prev_time = state.predictedDisplayTime;
+
+		if (state.shouldRender) {
+			XrViewLocateInfo locate_info = { XR_TYPE_VIEW_LOCATE_INFO };
+			locate_info.viewConfigurationType = live_view_config;
+			locate_info.displayTime           = state.predictedDisplayTime;
+			locate_info.space                 = space;
+			XrViewState view_state = { XR_TYPE_VIEW_STATE };
+			XrView      views[layers_max_views];
+			uint32_t    located = 0;
+			for (uint32_t v = 0; v < view_count; v++) views[v] = { XR_TYPE_VIEW };
+			xrLocateViews(xr_session, &locate_info, &view_state, view_count, &located, views);
+			for (uint32_t v = 0; v < located && v < view_count; v++) {
+				ref_views[v].pose = views[v].pose;
+				ref_views[v].fov  = views[v].fov;
+			}
+
+			// Every swapchain a layer uses needs a released image
+			XrSwapchainImageAcquireInfo acquire_info = { XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO };
+			XrSwapchainImageWaitInfo    wait_info    = { XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO };
+			XrSwapchainImageReleaseInfo release_info = { XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO };
+			wait_info.timeout = XR_INFINITE_DURATION;
+			uint32_t index = 0;
+			result = xrAcquireSwapchainImage(swapchain, &acquire_info, &index);
+			if (XR_SUCCEEDED(result)) result = xrWaitSwapchainImage   (swapchain, &wait_info);
+			if (XR_SUCCEEDED(result)) result = xrReleaseSwapchainImage(swapchain, &release_info);
+			if (XR_FAILED(result)) {
+				// The frame's already begun, so it still has to end, just
+				// without layers pointing at a swapchain that has no image.
+				live_frame_end(&state, nullptr, 0);
+				break;
+			}
+		}
+
+		clock::time_point end_start = clock::now();
+		result = live_frame_end(&state, layers, layer_count);
+		float end_us = std::chrono::duration<float, std::micro>(clock::now() - end_start).count();
+		if (XR_FAILED(result)) break;
+
+		// Frames the runtime didn't want drawn don't get layers either
+		if (state.shouldRender) end_times.add(end_us);
+	}
+
+	if (XR_FAILED(result)) step.error = openxr_result_string(result);
+	end_times.sort();
+	step.frames  = (int32_t)end_times.count;
+	step.end_p50 = live_percentile(end_times.data, (int32_t)end_times.count, 50);
+	step.end_p99 = live_percentile(end_times.data, (int32_t)end_times.count, 99);
+	end_times.free();
+	return step;
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "array.h"
+
+// Submits 1 through maxLayerCount composition layers to xrEndFrame, first
+// as quads, then as projections, and times xrEndFrame at each count. Frames
+// the runtime skipped count as dropped. A live test, duration is split
+// between all the counts, and it has to run on the thread with the
+// graphics context since it needs a swapchain.
+const char *layers_stress(float duration_sec, array_t<const char *> *ref_items);
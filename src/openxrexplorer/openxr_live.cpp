@@ -0,0 +1,257 @@
+#include "openxr_live.h"
+#include "openxr_refresh.h"
+#include "openxr_events.h"
+#include "openxr_locate.h"
+#include "openxr_swapchain.h"
+#include "openxr_layers.h"
+#include "openxr_actions.h"
+
+#include <math.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+/*** Global Variables ********************/
+
+const live_test_t live_tests[] = {
+	{ "SessionLifecycle", "session-lifecycle",
+	  "Begins the session and runs frames, timing each state change from xrCreateSession on. The Events window shows everything that came in. Duration is how long frames run for.",
+	  3, 3, events_lifecycle },
+	{ "RefreshRateValidation", "xrRequestDisplayRefreshRateFB",
+	  "Requests every rate from xrEnumerateDisplayRefreshRatesFB, and measures how often xrWaitFrame actually returns at each. Duration is per rate.",
+	  6, 3, refresh_validate },
+	{ "LocateThroughput", "xrLocateSpace",
+	  "Calls xrLocateSpace between each reference space and LOCAL, and xrLocateViews, from several threads at once. Pose jitter only means something if the device sits still. Duration is per space.",
+	  6, 2, locate_benchmark },
+	{ "SwapchainCost", "xrCreateSwapchain",
+	  "Creates a swapchain for every format from xrEnumerateSwapchainFormats at each recommended view size, and times creation, image enumeration, and acquire/wait/release. Graphics APIs want this on the main thread, so the window stops while it runs. Duration is split between the swapchains.",
+	  6, 2, swapchain_benchmark, true },
+	{ "LayerStress", "XrSystemGraphicsProperties",
+	  "Submits 1 through maxLayerCount quad layers to xrEndFrame, then projection layers, and times xrEndFrame at each count. Needs a swapchain, so the window stops while it runs. Duration is split between all the counts.",
+	  5, 16, layers_stress, true, (1 << 1) | (1 << 2) | (1 << 3) | (1 << 4) },
+	{ "ActionSync", "xrSyncActions",
+	  "Creates action sets with 1 to 64 actions of each type, suggests bindings for them on every core interaction profile, attaches them all, and times xrSyncActions on each set. Sets only attach once per session, so after the first run only syncing is redone. Duration is split between the sets.",
+	  6, 7, actions_benchmark, false, (1 << 2) | (1 << 4) },
+};
+
+// How long the runtime gets to move the session to READY, or STOPPING
+const int32_t live_state_timeout_ms = 5000;
+
+std::thread           live_thread;
+bool                  live_active   = false;
+std::atomic<bool>     live_done     = { false };
+std::atomic<bool>     live_cancel   = { false };
+std::atomic<float>    live_progress = { 0 };
+int32_t               live_current  = -1;
+array_t<const char *> live_items    = {};
+const char           *live_error    = nullptr;
+
+// Only the test thread touches these while a test is running
+bool                    live_began       = false;
+XrViewConfigurationType live_view_config = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
+XrEnvironmentBlendMode  live_blend_mode  = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
+
+/*** Code ********************************/
+
+int32_t            live_test_count()             { return sizeof(live_tests) / sizeof(live_tests[0]); }
+const live_test_t *live_test_get  (int32_t test) { return &live_tests[test]; }
+
+
+///////////////////////////////////////////
+
+const char *live_test_start(int32_t test, float duration_sec) {
+	live_test_stop();
+	if (test < 0 || test >= live_test_count()) return "Unknown test";
+
+	// Instance, system and session setup isn't thread safe, so that all
+	// happens here rather than on the test thread.
+	openxr_load_tag(display_tag_view);
+	openxr_require_session();
+	if (xr_session_err) return xr_session_err;
+
+	if (!live_began) {
+		live_view_config = xr_view.current_config;
+		live_blend_mode  = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
+		for (size_t i = 0; i < xr_view.configs.count; i++) {
+			const xr_view_config_info_t *config = &xr_view.configs[i];
+			if (config->form == xr_settings.form && config->type == live_view_config && config->blend_modes.count > 0)
+				live_blend_mode = config->blend_modes[0];
+		}
+	}
+
+	live_items.clear();
+	live_error   = nullptr;
+	live_current = test;
+	live_done    .store(false);
+	live_cancel  .store(false);
+	live_progress.store(0);
+	live_active  = true;
+	if (live_tests[test].same_thread) {
+		live_error = live_tests[test].run(duration_sec, &live_items);
+		live_done.store(true);
+		return nullptr;
+	}
+	live_thread  = std::thread([duration_sec]() {
+		live_error = live_tests[live_current].run(duration_sec, &live_items);
+		live_done.store(true);
+	});
+	return nullptr;
+}
+
+///////////////////////////////////////////
+
+void live_test_stop() {
+	if (!live_active) return;
+	live_cancel.store(true);
+	if (live_thread.joinable()) live_thread.join();
+	live_active = false;
+	live_items.clear();
+}
+
+///////////////////////////////////////////
+
+bool live_test_running() {
+	return live_active && !live_done.load();
+}
+
+///////////////////////////////////////////
+
+float live_test_progress() {
+	return live_progress.load();
+}
+
+///////////////////////////////////////////
+
+display_table_t *live_test_collect() {
+	if (!live_active || !live_done.load()) return nullptr;
+	if (live_thread.joinable()) live_thread.join();
+	live_active = false;
+
+	// Results are per system and view configuration, so running again only
+	// replaces the table for the same ones.
+	const live_test_t *test  = &live_tests[live_current];
+	display_table_t   *table = nullptr;
+	for (size_t i = 0; i < xr_tables.count; i++) {
+		if (xr_tables[i].tag == display_tag_live && xr_tables[i].name_type == test->name && xr_tables[i].form == xr_settings.form && xr_tables[i].view_config == live_view_config)
+			table = &xr_tables[i];
+	}
+	if (table == nullptr) {
+		display_table_t new_table = {};
+		new_table.name_type    = test->name;
+		new_table.spec         = test->spec;
+		new_table.tag          = display_tag_live;
+		new_table.show_type    = true;
+		new_table.header_row   = true;
+		new_table.column_count = test->column_count;
+		new_table.form         = xr_settings.form;
+		new_table.view_config  = live_view_config;
+		table = openxr_add_table(new_table);
+	}
+
+	for (int32_t c = 0; c < table->column_count; c++)
+		table->cols[c].clear();
+	for (size_t i = 0; i < live_items.count; i++)
+		table->cols[i % table->column_count].add({ live_items[i] });
+	table->error = live_error;
+	live_items.clear();
+	return table;
+}
+
+///////////////////////////////////////////
+
+void live_release() {
+	live_test_stop();
+	live_items.free();
+	actions_release();
+
+	// Ending a session means asking the runtime to stop it, then running
+	// frames until it gets around to saying STOPPING.
+	if (live_began) {
+		xrRequestExitSession(xr_session);
+		auto start = std::chrono::steady_clock::now();
+		while (events_session_state() != XR_SESSION_STATE_STOPPING && std::chrono::steady_clock::now() - start < std::chrono::milliseconds(live_state_timeout_ms)) {
+			XrFrameState state = { XR_TYPE_FRAME_STATE };
+			if (XR_FAILED(live_frame_begin(&state)) || XR_FAILED(live_frame_end(&state, nullptr, 0)))
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+		xrEndSession(xr_session);
+	}
+	live_began = false;
+}
+
+///////////////////////////////////////////
+
+XrResult live_session_begin() {
+	if (live_began) return XR_SUCCESS;
+
+	// The runtime moves new sessions to READY by itself, and says so with
+	// an event.
+	auto start = std::chrono::steady_clock::now();
+	for (XrSessionState state = events_session_state(); state != XR_SESSION_STATE_READY; state = events_session_state()) {
+		if (state == XR_SESSION_STATE_EXITING || state == XR_SESSION_STATE_LOSS_PENDING)
+			return XR_ERROR_SESSION_LOST;
+		if (live_cancelled() || std::chrono::steady_clock::now() - start > std::chrono::milliseconds(live_state_timeout_ms))
+			return XR_ERROR_SESSION_NOT_READY;
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	XrSessionBeginInfo begin_info = { XR_TYPE_SESSION_BEGIN_INFO };
+	begin_info.primaryViewConfigurationType = live_view_config;
+	events_mark(events_mark_begin);
+	XrResult result = xrBeginSession(xr_session, &begin_info);
+	events_mark(events_mark_begun);
+	live_began = XR_SUCCEEDED(result);
+	return result;
+}
+
+///////////////////////////////////////////
+
+XrResult live_frame_begin(XrFrameState *out_state) {
+	XrSessionState state = events_session_state();
+	if (state == XR_SESSION_STATE_STOPPING || state == XR_SESSION_STATE_EXITING || state == XR_SESSION_STATE_LOSS_PENDING)
+		return XR_ERROR_SESSION_NOT_RUNNING;
+
+	XrFrameWaitInfo wait_info = { XR_TYPE_FRAME_WAIT_INFO };
+	out_state->type = XR_TYPE_FRAME_STATE;
+	XrResult result = xrWaitFrame(xr_session, &wait_info, out_state);
+	if (XR_FAILED(result)) return result;
+
+	XrFrameBeginInfo begin_info = { XR_TYPE_FRAME_BEGIN_INFO };
+	return xrBeginFrame(xr_session, &begin_info);
+}
+
+///////////////////////////////////////////
+
+XrResult live_frame_end(const XrFrameState *state, const XrCompositionLayerBaseHeader *const *layers, uint32_t layer_count) {
+	XrFrameEndInfo end_info = { XR_TYPE_FRAME_END_INFO };
+	end_info.displayTime          = state->predictedDisplayTime;
+	end_info.environmentBlendMode = live_blend_mode;
+	end_info.layerCount           = state->shouldRender ? layer_count : 0;
+	end_info.layers               = layers;
+	return xrEndFrame(xr_session, &end_info);
+}
+
+///////////////////////////////////////////
+
+bool live_cancelled() {
+	return live_cancel.load();
+}
+
+///////////////////////////////////////////
+
+void live_set_progress(float progress) {
+	live_progress.store(progress);
+}
+
+///////////////////////////////////////////
+
+float live_percentile(const float *values, int32_t count, float percentile) {
+	if (count <= 0) return NAN;
+
+	// Nearest rank, no interpolation
+	int32_t rank = (int32_t)ceilf(percentile / 100.0f * count) - 1;
+	if (rank < 0)      rank = 0;
+	if (rank >= count) rank = count - 1;
+	return values[rank];
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "array.h"
+#include "openxr_info.h"
+
+#include <stdint.h>
+
+// Live tests run xr_session for real, frame loop and all, on a thread of
+// their own. Results come back as rows of text, which get turned into a
+// display_table_t once the test is done, see live_test_collect.
+
+/*** Types *******************************/
+
+struct live_test_t {
+	const char *name;
+	const char *spec;
+	const char *description;
+	int32_t     column_count;
+	// What the duration means is up to the test.
+	float       default_duration;
+
+	// Called from the test thread. Items fill a row at a time, and the
+	// first row is the header, same as xr_enum_info_t. Returns an error
+	// message, or nullptr.
+	const char *(*run)(float duration_sec, array_t<const char *> *ref_items);
+
+	// Some graphics APIs, like OpenGL, only work on the thread their
+	// context is current on. Tests that touch graphics resources run on
+	// the thread that started them instead, and block it until done.
+	bool        same_thread;
+	// A bit for each column worth plotting down the rows, like a curve
+	// over layer counts. Cells are read as numbers up to the first thing
+	// that isn't one, and rows that don't start with a number are totals
+	// or notes, so they're left out.
+	uint32_t    plot_columns;
+};
+
+/*** Global Variables ********************/
+
+// What the session was begun with, for tests that need to know.
+extern XrViewConfigurationType live_view_config;
+
+/*** Signatures **************************/
+
+int32_t            live_test_count();
+const live_test_t *live_test_get  (int32_t test);
+
+// Sets up the session on the calling thread, then starts the test on its
+// own, or runs it right here for same_thread tests. Returns an error
+// message, or nullptr if the test started. Stops any test that's already
+// going.
+const char *live_test_start   (int32_t test, float duration_sec);
+void        live_test_stop    ();
+bool        live_test_running ();
+float       live_test_progress();
+
+// Puts the results of a finished test into xr_tables, from the thread that
+// owns the tables. Returns the table, or nullptr if nothing finished.
+display_table_t *live_test_collect();
+
+// Stops any test, and ends the session if a test began it. Needs doing
+// before xr_session is destroyed.
+void live_release();
+
+// For the tests themselves, from the test thread.
+XrResult live_session_begin();
+XrResult live_frame_begin  (XrFrameState *out_state);
+XrResult live_frame_end    (const XrFrameState *state, const XrCompositionLayerBaseHeader *const *layers, uint32_t layer_count);
+bool     live_cancelled    ();
+void     live_set_progress (float progress);
+// values need to be sorted already.
+float    live_percentile   (const float *values, int32_t count, float percentile);
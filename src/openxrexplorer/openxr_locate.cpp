@@ -0,0 +1,297 @@
+#include "openxr_locate.h"
+#include "openxr_live.h"
+#include "openxr_enums.h"
+
+#include <openxr/openxr_reflection.h>
+
+#include <string.h>
+#include <math.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+/*** Types *******************************/
+
+struct locate_target_t {
+	const char   *name;
+	XrSpace       space;
+	XrSpace       base;
+	bool          views;
+	// Orientation jitter is measured against this
+	XrQuaternionf reference;
+	bool          has_reference;
+};
+
+struct locate_worker_t {
+	uint64_t calls;
+	uint64_t failed;
+	uint64_t valid;
+	uint64_t tracked;
+	uint32_t histogram[256];
+
+	uint64_t poses;
+	double   pos_sum[3];
+	double   pos_sq [3];
+	double   ang_sum;
+	double   ang_sq;
+};
+
+/*** Global Variables ********************/
+
+const int32_t locate_thread_count = 4;
+const int32_t locate_max_views    = 16;
+// Latency buckets are spaced by a fraction of a doubling of nanoseconds,
+// so they stay about as precise from 100ns to 100ms.
+const int32_t locate_bucket_steps = 8;
+const int32_t locate_bucket_count = sizeof(locate_worker_t::histogram) / sizeof(locate_worker_t::histogram[0]);
+
+std::atomic<XrTime> locate_time = { 0 };
+std::atomic<bool>   locate_stop = { false };
+
+/*** Signatures **************************/
+
+XrResult    locate_once      (const locate_target_t *target, XrTime time, XrPosef *out_pose, bool *out_valid, bool *out_tracked);
+void        locate_worker    (const locate_target_t *target, locate_worker_t *ref_worker);
+const char *locate_space_name(XrReferenceSpaceType type);
+double      locate_percentile(const uint32_t *histogram, uint64_t total, float percentile);
+
+/*** Code ********************************/
+
+const char *locate_benchmark(float duration_sec, array_t<const char *> *ref_items) {
+	typedef std::chrono::steady_clock clock;
+
+	XrResult result = live_session_begin();
+	if (XR_FAILED(result)) return openxr_result_string(result);
+
+	uint32_t count = 0;
+	result = xrEnumerateReferenceSpaces(xr_session, 0, &count, nullptr);
+	if (XR_FAILED(result)) return openxr_result_string(result);
+	array_t<XrReferenceSpaceType> types(count, (XrReferenceSpaceType)0);
+	xrEnumerateReferenceSpaces(xr_session, count, &count, types.data);
+	types.count = count;
+
+	// Everything gets located relative to LOCAL if it's around
+	array_t<XrSpace> spaces = {};
+	int32_t base  = -1;
+	int32_t view  = -1;
+	int32_t stage = -1;
+	for (size_t i = 0; i < types.count; i++) {
+		XrReferenceSpaceCreateInfo info = { XR_TYPE_REFERENCE_SPACE_CREATE_INFO };
+		info.referenceSpaceType   = types[i];
+		info.poseInReferenceSpace = { {0,0,0,1}, {0,0,0} };
+		XrSpace space = XR_NULL_HANDLE;
+		xrCreateReferenceSpace(xr_session, &info, &space);
+		spaces.add(space);
+		if (types[i] == XR_REFERENCE_SPACE_TYPE_LOCAL) base  = (int32_t)i;
+		if (types[i] == XR_REFERENCE_SPACE_TYPE_VIEW ) view  = (int32_t)i;
+		if (types[i] == XR_REFERENCE_SPACE_TYPE_STAGE) stage = (int32_t)i;
+	}
+	if (base == -1) base = 0;
+
+	array_t<locate_target_t> targets = {};
+	for (size_t i = 0; i < spaces.count; i++) {
+		if ((int32_t)i == base) continue;
+		targets.add({ new_string("%s in %s", locate_space_name(types[i]), locate_space_name(types[base])), spaces[i], spaces[base] });
+	}
+	if (view != -1 && stage != -1 && stage != base)
+		targets.add({ new_string("VIEW in STAGE"), spaces[view], spaces[stage] });
+	if (spaces.count > 0)
+		targets.add({ new_string("xrLocateViews in %s", locate_space_name(types[base])), XR_NULL_HANDLE, spaces[base], true });
+
+	ref_items->add("Locate");
+	ref_items->add(new_string("Calls/s (%d threads)", locate_thread_count));
+	ref_items->add("Latency p50/p99/max (us)");
+	ref_items->add("Valid / tracked");
+	ref_items->add("Jitter (mm)");
+	ref_items->add("Jitter (deg)");
+
+	locate_worker_t workers[locate_thread_count];
+	std::thread     threads[locate_thread_count];
+	for (size_t t = 0; t < targets.count && !live_cancelled(); t++) {
+		locate_target_t *target = &targets[t];
+
+		// Locating needs a display time from a frame that's actually going
+		XrFrameState state = { XR_TYPE_FRAME_STATE };
+		if (XR_SUCCEEDED(result = live_frame_begin(&state)))
+			result = live_frame_end(&state, nullptr, 0);
+		if (XR_FAILED(result)) break;
+		locate_time.store(state.predictedDisplayTime);
+
+		XrPosef pose;
+		bool    valid, tracked;
+		if (XR_SUCCEEDED(locate_once(target, state.predictedDisplayTime, &pose, &valid, &tracked)) && valid) {
+			target->reference     = pose.orientation;
+			target->has_reference = true;
+		}
+
+		memset(workers, 0, sizeof(workers));
+		locate_stop.store(false);
+		for (int32_t i = 0; i < locate_thread_count; i++)
+			threads[i] = std::thread(locate_worker, target, &workers[i]);
+
+		// Frames keep coming while the workers go, so display times move
+		// along the way they would in an app.
+		clock::time_point start = clock::now();
+		float             elapsed = 0;
+		while (elapsed < duration_sec && !live_cancelled()) {
+			if (XR_FAILED(result = live_frame_begin(&state))) break;
+			locate_time.store(state.predictedDisplayTime);
+			if (XR_FAILED(result = live_frame_end(&state, nullptr, 0))) break;
+			elapsed = std::chrono::duration<float>(clock::now() - start).count();
+			live_set_progress((t + elapsed / duration_sec) / targets.count);
+		}
+		locate_stop.store(true);
+		for (int32_t i = 0; i < locate_thread_count; i++)
+			threads[i].join();
+		elapsed = std::chrono::duration<float>(clock::now() - start).count();
+		if (XR_FAILED(result)) break;
+
+		locate_worker_t total = {};
+		for (int32_t i = 0; i < locate_thread_count; i++) {
+			total.calls   += workers[i].calls;
+			total.failed  += workers[i].failed;
+			total.valid   += workers[i].valid;
+			total.tracked += workers[i].tracked;
+			total.poses   += workers[i].poses;
+			total.ang_sum += workers[i].ang_sum;
+			total.ang_sq  += workers[i].ang_sq;
+			for (int32_t a = 0; a < 3; a++) {
+				total.pos_sum[a] += workers[i].pos_sum[a];
+				total.pos_sq [a] += workers[i].pos_sq [a];
+			}
+			for (int32_t b = 0; b < locate_bucket_count; b++)
+				total.histogram[b] += workers[i].histogram[b];
+		}
+
+		ref_items->add(target->name);
+		ref_items->add(new_string("%.0f", total.calls / elapsed));
+		ref_items->add(new_string("%.2f / %.2f / %.2f",
+			locate_percentile(total.histogram, total.calls, 50),
+			locate_percentile(total.histogram, total.calls, 99),
+			locate_percentile(total.histogram, total.calls, 100)));
+		ref_items->add(total.calls == 0 ? "N/A" : new_string(total.failed > 0 ? "%.0f%% / %.0f%% (%llu failed)" : "%.0f%% / %.0f%%",
+			100.0 * total.valid   / total.calls,
+			100.0 * total.tracked / total.calls,
+			(unsigned long long)total.failed));
+		if (total.poses > 1) {
+			double pos_var = 0;
+			for (int32_t a = 0; a < 3; a++) {
+				double mean = total.pos_sum[a] / total.poses;
+				pos_var += total.pos_sq[a] / total.poses - mean * mean;
+			}
+			double ang_mean = total.ang_sum / total.poses;
+			double ang_var  = total.ang_sq / total.poses - ang_mean * ang_mean;
+			ref_items->add(new_string("%.3f", sqrt(fmax(pos_var, 0)) * 1000));
+			ref_items->add(target->has_reference ? new_string("%.3f", sqrt(fmax(ang_var, 0))) : "N/A");
+		} else {
+			ref_items->add("N/A");
+			ref_items->add("N/A");
+		}
+	}
+	if (XR_FAILED(result)) {
+		ref_items->add("Frame loop stopped");
+		ref_items->add(openxr_result_string(result));
+		for (int32_t i = 0; i < 4; i++) ref_items->add("");
+	}
+
+	for (size_t i = 0; i < spaces.count; i++) {
+		if (spaces[i] != XR_NULL_HANDLE) xrDestroySpace(spaces[i]);
+	}
+	spaces .free();
+	targets.free();
+	types  .free();
+	return nullptr;
+}
+
+///////////////////////////////////////////
+
+XrResult locate_once(const locate_target_t *target, XrTime time, XrPosef *out_pose, bool *out_valid, bool *out_tracked) {
+	if (target->views) {
+		XrViewLocateInfo info = { XR_TYPE_VIEW_LOCATE_INFO };
+		info.viewConfigurationType = live_view_config;
+		info.displayTime           = time;
+		info.space                 = target->base;
+		XrViewState state = { XR_TYPE_VIEW_STATE };
+		XrView      views[locate_max_views];
+		for (int32_t i = 0; i < locate_max_views; i++) views[i] = { XR_TYPE_VIEW };
+		uint32_t    count = 0;
+
+		XrResult result = xrLocateViews(xr_session, &info, &state, locate_max_views, &count, views);
+		*out_pose    = views[0].pose;
+		*out_valid   = XR_SUCCEEDED(result) && count > 0 && (state.viewStateFlags & XR_VIEW_STATE_POSITION_VALID_BIT)   && (state.viewStateFlags & XR_VIEW_STATE_ORIENTATION_VALID_BIT);
+		*out_tracked = XR_SUCCEEDED(result) && count > 0 && (state.viewStateFlags & XR_VIEW_STATE_POSITION_TRACKED_BIT) && (state.viewStateFlags & XR_VIEW_STATE_ORIENTATION_TRACKED_BIT);
+		return result;
+	}
+
+	XrSpaceLocation location = { XR_TYPE_SPACE_LOCATION };
+	XrResult result = xrLocateSpace(target->space, target->base, time, &location);
+	*out_pose    = location.pose;
+	*out_valid   = XR_SUCCEEDED(result) && (location.locationFlags & XR_SPACE_LOCATION_POSITION_VALID_BIT)   && (location.locationFlags & XR_SPACE_LOCATION_ORIENTATION_VALID_BIT);
+	*out_tracked = XR_SUCCEEDED(result) && (location.locationFlags & XR_SPACE_LOCATION_POSITION_TRACKED_BIT) && (location.locationFlags & XR_SPACE_LOCATION_ORIENTATION_TRACKED_BIT);
+	return result;
+}
+
+///////////////////////////////////////////
+
+void locate_worker(const locate_target_t *target, locate_worker_t *ref_worker) {
+	typedef std::chrono::steady_clock clock;
+
+	while (!locate_stop.load(std::memory_order_relaxed)) {
+		XrTime  time = locate_time.load(std::memory_order_relaxed);
+		XrPosef pose;
+		bool    valid, tracked;
+
+		clock::time_point start  = clock::now();
+		XrResult          result = locate_once(target, time, &pose, &valid, &tracked);
+		int64_t           ns     = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+
+		int32_t bucket = ns > 1 ? (int32_t)(log2((double)ns) * locate_bucket_steps) : 0;
+		if (bucket >= locate_bucket_count) bucket = locate_bucket_count - 1;
+		ref_worker->histogram[bucket] += 1;
+		ref_worker->calls   += 1;
+		ref_worker->failed  += XR_FAILED(result) ? 1 : 0;
+		ref_worker->valid   += valid   ? 1 : 0;
+		ref_worker->tracked += tracked ? 1 : 0;
+		if (!valid) continue;
+
+		const float *pos = &pose.position.x;
+		for (int32_t a = 0; a < 3; a++) {
+			ref_worker->pos_sum[a] += pos[a];
+			ref_worker->pos_sq [a] += (double)pos[a] * pos[a];
+		}
+		if (target->has_reference) {
+			const XrQuaternionf &q = pose.orientation, &r = target->reference;
+			double dot   = fmin(fabs((double)q.x*r.x + (double)q.y*r.y + (double)q.z*r.z + (double)q.w*r.w), 1.0);
+			double angle = 2 * acos(dot) * 180.0 / 3.14159265358979;
+			ref_worker->ang_sum += angle;
+			ref_worker->ang_sq  += angle * angle;
+		}
+		ref_worker->poses += 1;
+	}
+}
+
+///////////////////////////////////////////
+
+double locate_percentile(const uint32_t *histogram, uint64_t total, float percentile) {
+	if (total == 0) return NAN;
+
+	// Reports the top of the bucket the percentile lands in
+	uint64_t target = (uint64_t)ceil(percentile / 100.0 * total);
+	uint64_t seen   = 0;
+	for (int32_t b = 0; b < locate_bucket_count; b++) {
+		seen += histogram[b];
+		if (seen >= target && seen > 0)
+			return pow(2.0, (b + 1) / (double)locate_bucket_steps) / 1000.0;
+	}
+	return pow(2.0, locate_bucket_count / (double)locate_bucket_steps) / 1000.0;
+}
+
+///////////////////////////////////////////
+
+const char *locate_space_name(XrReferenceSpaceType type) {
+	const char *name = enums_name(type);
+	if (name == nullptr) return "UNKNOWN";
+	const char *prefix = "XR_REFERENCE_SPACE_TYPE_";
+	return strncmp(name, prefix, strlen(prefix)) == 0 ? name + strlen(prefix) : name;
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "array.h"
+
+// Creates every reference space xrEnumerateReferenceSpaces lists, and
+// hammers xrLocateSpace and xrLocateViews from several threads at once,
+// at the predicted display time of a running frame loop. Reports calls per
+// second, per call latency, how often poses were valid and tracked, and
+// how much they moved, which is jitter if the device sits still. A live
+// test, duration is per space.
+const char *locate_benchmark(float duration_sec, array_t<const char *> *ref_items);
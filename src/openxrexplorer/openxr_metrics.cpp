@@ -0,0 +1,206 @@
+#include "openxr_metrics.h"
+#include "openxr_info.h"
+#include "openxr_paths.h"
+#include "openxr_dispatch.h"
+
+#include <stdlib.h>
+#include <math.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+/*** Types *******************************/
+
+struct metrics_counter_t {
+	const char *name;
+	XrPath      path;
+	const char *unit;
+	float      *values;
+};
+
+/*** Global Variables ********************/
+
+// Power of two, so sample numbers map straight onto ring slots. At 120Hz
+// this is over half a minute of history.
+const int32_t metrics_ring_size = 4096;
+
+array_t<metrics_counter_t> metrics_counters = {};
+double                    *metrics_times    = nullptr;
+float                      metrics_rate     = 0;
+
+// The sampler fills in a slot for every counter, then publishes it by
+// bumping this, so readers never see half a sample.
+std::atomic<uint64_t> metrics_written = { 0 };
+std::atomic<bool>     metrics_active  = { false };
+std::thread           metrics_thread;
+
+/*** Signatures **************************/
+
+void        metrics_sampler();
+const char *metrics_unit_name(XrPerformanceMetricsCounterUnitMETA unit);
+
+/*** Code ********************************/
+
+XrResult metrics_start(const char **counter_paths, int32_t counter_count, float rate_hz) {
+	metrics_stop();
+	if (xr_session == XR_NULL_HANDLE) return XR_ERROR_SESSION_NOT_RUNNING;
+	if (rate_hz <= 0)                 return XR_ERROR_VALIDATION_FAILURE;
+
+	if (xr_ext.xrSetPerformanceMetricsStateMETA == nullptr || xr_ext.xrQueryPerformanceMetricsCounterMETA == nullptr)
+		return XR_ERROR_FUNCTION_UNSUPPORTED;
+
+	XrPerformanceMetricsStateMETA state = { XR_TYPE_PERFORMANCE_METRICS_STATE_META };
+	state.enabled = XR_TRUE;
+	XrResult result = xr_ext.xrSetPerformanceMetricsStateMETA(xr_session, &state);
+	if (XR_FAILED(result)) return result;
+
+	for (int32_t i = 0; i < counter_count; i++) {
+		metrics_counter_t counter = {};
+		counter.name   = counter_paths[i];
+		counter.unit   = "";
+		counter.values = (float *)calloc(metrics_ring_size, sizeof(float));
+		paths_from_string(counter_paths[i], &counter.path);
+		metrics_counters.add(counter);
+	}
+	metrics_times = (double *)calloc(metrics_ring_size, sizeof(double));
+	metrics_rate  = rate_hz;
+	metrics_written.store(0);
+	metrics_active .store(true);
+	metrics_thread = std::thread(metrics_sampler);
+	return XR_SUCCESS;
+}
+
+///////////////////////////////////////////
+
+void metrics_stop() {
+	if (!metrics_active.exchange(false))
+		return;
+	metrics_thread.join();
+
+	XrPerformanceMetricsStateMETA state = { XR_TYPE_PERFORMANCE_METRICS_STATE_META };
+	state.enabled = XR_FALSE;
+	if (xr_session != XR_NULL_HANDLE)
+		xr_ext.xrSetPerformanceMetricsStateMETA(xr_session, &state);
+
+	metrics_counters.each([](metrics_counter_t &c) { free(c.values); });
+	metrics_counters.free();
+	free(metrics_times);
+	metrics_times = nullptr;
+}
+
+///////////////////////////////////////////
+
+bool metrics_running() {
+	return metrics_active.load();
+}
+
+///////////////////////////////////////////
+
+int32_t     metrics_counter_count()                { return (int32_t)metrics_counters.count; }
+const char *metrics_counter_name (int32_t counter) { return metrics_counters[counter].name; }
+const char *metrics_counter_unit (int32_t counter) { return metrics_counters[counter].unit; }
+uint64_t    metrics_sample_count ()                { return metrics_written.load(std::memory_order_acquire); }
+
+///////////////////////////////////////////
+
+void metrics_sampler() {
+	typedef std::chrono::steady_clock clock;
+	const clock::time_point start  = clock::now();
+	const clock::duration   period = std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(1.0 / metrics_rate));
+
+	clock::time_point next = start;
+	while (metrics_active.load()) {
+		uint64_t sample = metrics_written.load(std::memory_order_relaxed);
+		size_t   slot   = sample & (metrics_ring_size - 1);
+
+		for (size_t i = 0; i < metrics_counters.count; i++) {
+			XrPerformanceMetricsCounterMETA value = { XR_TYPE_PERFORMANCE_METRICS_COUNTER_META };
+			XrResult result = xr_ext.xrQueryPerformanceMetricsCounterMETA(xr_session, metrics_counters[i].path, &value);
+
+			float result_value = NAN;
+			if      (XR_FAILED(result)) {}
+			else if (value.counterFlags & XR_PERFORMANCE_METRICS_COUNTER_FLOAT_VALUE_VALID_BIT_META) result_value = value.floatValue;
+			else if (value.counterFlags & XR_PERFORMANCE_METRICS_COUNTER_UINT_VALUE_VALID_BIT_META ) result_value = (float)value.uintValue;
+			if (XR_SUCCEEDED(result) && sample == 0)
+				metrics_counters[i].unit = metrics_unit_name(value.counterUnit);
+			metrics_counters[i].values[slot] = result_value;
+		}
+		metrics_times[slot] = std::chrono::duration<double>(clock::now() - start).count();
+		metrics_written.store(sample + 1, std::memory_order_release);
+
+		// Scheduled from the start rather than the last wake up, so the rate
+		// doesn't drift with how long the queries take.
+		next += period;
+		if (next < clock::now()) next = clock::now();
+		std::this_thread::sleep_until(next);
+	}
+}
+
+///////////////////////////////////////////
+
+bool metrics_read(uint64_t sample, double *out_time, float *out_values) {
+	uint64_t written = metrics_written.load(std::memory_order_acquire);
+	if (sample >= written || written - sample > metrics_ring_size - 1)
+		return false;
+
+	size_t slot = sample & (metrics_ring_size - 1);
+	*out_time = metrics_times[slot];
+	for (size_t i = 0; i < metrics_counters.count; i++)
+		out_values[i] = metrics_counters[i].values[slot];
+
+	// If the sampler lapped us while copying, the copy can't be trusted. One
+	// slot is kept spare, since the sampler may be mid-write on it.
+	written = metrics_written.load(std::memory_order_acquire);
+	return written - sample <= metrics_ring_size - 1;
+}
+
+///////////////////////////////////////////
+
+int32_t metrics_history(int32_t counter, double window_sec, float *out_values, int32_t max_values) {
+	uint64_t written = metrics_written.load(std::memory_order_acquire);
+	if (written == 0) return 0;
+
+	// Walk backwards until the window or the buffer runs out
+	double   newest = metrics_times[(written - 1) & (metrics_ring_size - 1)];
+	uint64_t first  = written;
+	while (first > 0 && written - (first - 1) < metrics_ring_size - 1 && (int32_t)(written - (first - 1)) <= max_values) {
+		if (newest - metrics_times[(first - 1) & (metrics_ring_size - 1)] > window_sec) break;
+		first--;
+	}
+
+	int32_t count = 0;
+	for (uint64_t s = first; s < written; s++)
+		out_values[count++] = metrics_counters[counter].values[s & (metrics_ring_size - 1)];
+	return count;
+}
+
+///////////////////////////////////////////
+
+metrics_stats_t metrics_stats(const float *values, int32_t count) {
+	metrics_stats_t result = { INFINITY, 0, -INFINITY, 0 };
+	double          total  = 0;
+	for (int32_t i = 0; i < count; i++) {
+		if (isnan(values[i])) continue;
+		if (result.min > values[i]) result.min = values[i];
+		if (result.max < values[i]) result.max = values[i];
+		total        += values[i];
+		result.count += 1;
+	}
+	result.avg = result.count > 0 ? (float)(total / result.count) : 0;
+	if (result.count == 0) { result.min = 0; result.max = 0; }
+	return result;
+}
+
+///////////////////////////////////////////
+
+const char *metrics_unit_name(XrPerformanceMetricsCounterUnitMETA unit) {
+	switch (unit) {
+	case XR_PERFORMANCE_METRICS_COUNTER_UNIT_GENERIC_META:      return "";
+	case XR_PERFORMANCE_METRICS_COUNTER_UNIT_PERCENTAGE_META:   return "%";
+	case XR_PERFORMANCE_METRICS_COUNTER_UNIT_MILLISECONDS_META: return "ms";
+	case XR_PERFORMANCE_METRICS_COUNTER_UNIT_BYTES_META:        return "bytes";
+	case XR_PERFORMANCE_METRICS_COUNTER_UNIT_HERTZ_META:        return "Hz";
+	default:                                                    return "";
+	}
+}
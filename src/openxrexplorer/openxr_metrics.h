@@ -0,0 +1,38 @@
+#pragma once
+
+#include <openxr/openxr.h>
+#include <stdint.h>
+
+// Live sampling of XR_META_performance_metrics counters. A sampler thread
+// queries every counter at a fixed rate into a ring buffer per counter,
+// and readers on any thread pick samples out without locking.
+
+/*** Types *******************************/
+
+struct metrics_stats_t {
+	float   min;
+	float   avg;
+	float   max;
+	int32_t count;
+};
+
+/*** Signatures **************************/
+
+// Needs xr_session. Stops any sampling that's already going.
+XrResult metrics_start  (const char **counter_paths, int32_t counter_count, float rate_hz);
+void     metrics_stop   ();
+bool     metrics_running();
+
+int32_t     metrics_counter_count();
+const char *metrics_counter_name (int32_t counter);
+const char *metrics_counter_unit (int32_t counter);
+
+// Samples are numbered from 0 as they're taken. Reading one that has been
+// overwritten since returns false. out_values needs room for every counter.
+uint64_t        metrics_sample_count();
+bool            metrics_read        (uint64_t sample, double *out_time, float *out_values);
+// Covers the samples from the last window_sec seconds, oldest first.
+int32_t         metrics_history     (int32_t counter, double window_sec, float *out_values, int32_t max_values);
+// Over values from metrics_history, so a plot and its numbers agree, and
+// there's no second trip through the ring buffer.
+metrics_stats_t metrics_stats       (const float *values, int32_t count);
@@ -0,0 +1,288 @@
+#include "openxr_paths.h"
+#include "openxr_info.h"
+#include "xrsnapshot.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <mutex>
+
+/*** Types *******************************/
+
+struct paths_entry_t {
+	XrPath      path;
+	const char *str;
+	uint64_t    str_hash;
+	// Failed lookups are cached too, a path the runtime didn't know a
+	// moment ago won't be any different now.
+	XrResult    result;
+	bool        has_path;
+	bool        has_str;
+};
+
+// Strings are packed into blocks that never move, so the pointers handed
+// out stay good until paths_clear.
+struct paths_block_t {
+	paths_block_t *next;
+	size_t         used;
+	size_t         size;
+};
+
+/*** Global Variables ********************/
+
+const size_t paths_block_size = 16 * 1024;
+
+std::mutex             paths_lock;
+array_t<paths_entry_t> paths_entries  = {};
+paths_block_t         *paths_blocks   = nullptr;
+size_t                 paths_bytes    = 0;
+uint64_t               paths_hits     = 0;
+uint64_t               paths_misses   = 0;
+
+// Open addressing with linear probing, power of two sized. Slots hold an
+// index into paths_entries plus one, so 0 is empty.
+int32_t               *paths_by_path  = nullptr;
+int32_t               *paths_by_str   = nullptr;
+uint32_t               paths_capacity = 0;
+
+/*** Signatures **************************/
+
+uint64_t    paths_hash_path(XrPath path);
+int32_t     paths_find_path(XrPath path);
+int32_t     paths_find_str (const char *str, uint64_t hash);
+void        paths_insert   (const paths_entry_t *entry);
+void        paths_slot_add (int32_t *table, uint64_t hash, int32_t index);
+void        paths_grow     ();
+const char *paths_copy     (const char *str, size_t len);
+
+/*** Code ********************************/
+
+void paths_resolve(const XrPath *paths, int32_t count) {
+	if (xr_instance == XR_NULL_HANDLE) return;
+
+	// Only the ones nobody has seen go to the runtime, and each of those
+	// only once, even if the list has it a few times over.
+	array_t<XrPath> missing = {};
+	paths_lock.lock();
+	for (int32_t i = 0; i < count; i++) {
+		if (paths_find_path(paths[i]) != -1) continue;
+		bool listed = false;
+		for (size_t m = 0; m < missing.count && !listed; m++) listed = missing[m] == paths[i];
+		if (!listed) missing.add(paths[i]);
+	}
+	paths_lock.unlock();
+
+	// Most paths fit in the spec's max length, so one call usually does it
+	// instead of asking for the size first.
+	for (size_t m = 0; m < missing.count; m++) {
+		char     buffer[XR_MAX_PATH_LENGTH];
+		char    *str    = buffer;
+		uint32_t length = 0;
+		XrResult result = xrPathToString(xr_instance, missing[m], sizeof(buffer), &length, buffer);
+		if (result == XR_ERROR_SIZE_INSUFFICIENT) {
+			// Longer than the spec allows, but the runtime gets the last word
+			str    = (char *)malloc(length + 1);
+			result = xrPathToString(xr_instance, missing[m], length, &length, str);
+		}
+		openxr_capture("xrPathToString", missing[m], result, str, sizeof(char), length);
+
+		paths_lock.lock();
+		if (paths_find_path(missing[m]) == -1) { // Another thread may have beaten us to it
+			paths_entry_t entry = {};
+			entry.path     = missing[m];
+			entry.result   = result;
+			entry.has_path = true;
+			if (XR_SUCCEEDED(result)) {
+				entry.str      = paths_copy(str, strlen(str));
+				entry.str_hash = snapshot_hash(entry.str);
+				entry.has_str  = paths_find_str(entry.str, entry.str_hash) == -1;
+			}
+			paths_insert(&entry);
+			paths_misses++;
+		}
+		paths_lock.unlock();
+		if (str != buffer) free(str);
+	}
+	missing.free();
+}
+
+///////////////////////////////////////////
+
+const char *paths_to_string(XrPath path) {
+	paths_lock.lock();
+	int32_t index = paths_find_path(path);
+	if (index != -1) paths_hits++;
+	paths_lock.unlock();
+	if (index == -1) paths_resolve(&path, 1);
+
+	// Entries can move when the list grows, so this copies out what's
+	// needed while nobody can add any.
+	paths_lock.lock();
+	index = paths_find_path(path);
+	paths_entry_t entry = index == -1 ? paths_entry_t{} : paths_entries[index];
+	paths_lock.unlock();
+	if (index == -1) return "No XrInstance available";
+	return XR_SUCCEEDED(entry.result) ? entry.str : openxr_result_string(entry.result);
+}
+
+///////////////////////////////////////////
+
+XrResult paths_from_string(const char *path_string, XrPath *out_path) {
+	uint64_t hash = snapshot_hash(path_string);
+
+	paths_lock.lock();
+	int32_t index = paths_find_str(path_string, hash);
+	if (index != -1) {
+		paths_hits++;
+		*out_path = paths_entries[index].path;
+		XrResult result = paths_entries[index].result;
+		paths_lock.unlock();
+		return result;
+	}
+	paths_lock.unlock();
+
+	XrPath   path   = XR_NULL_PATH;
+	XrResult result = xrStringToPath(xr_instance, path_string, &path);
+
+	paths_lock.lock();
+	if (paths_find_str(path_string, hash) == -1) {
+		paths_entry_t entry = {};
+		entry.path     = path;
+		entry.str      = paths_copy(path_string, strlen(path_string));
+		entry.str_hash = hash;
+		entry.result   = result;
+		entry.has_str  = true;
+		entry.has_path = XR_SUCCEEDED(result) && paths_find_path(path) == -1;
+		paths_insert(&entry);
+		paths_misses++;
+	}
+	paths_lock.unlock();
+
+	*out_path = path;
+	return result;
+}
+
+///////////////////////////////////////////
+
+paths_stats_t paths_stats() {
+	paths_lock.lock();
+	paths_stats_t result = {};
+	result.count        = (int32_t)paths_entries.count;
+	result.hits         = paths_hits;
+	result.misses       = paths_misses;
+	result.string_bytes = paths_bytes;
+	paths_lock.unlock();
+	return result;
+}
+
+///////////////////////////////////////////
+
+void paths_clear() {
+	paths_lock.lock();
+	while (paths_blocks) {
+		paths_block_t *next = paths_blocks->next;
+		free(paths_blocks);
+		paths_blocks = next;
+	}
+	free(paths_by_path);
+	free(paths_by_str);
+	paths_entries.free();
+	paths_by_path  = nullptr;
+	paths_by_str   = nullptr;
+	paths_capacity = 0;
+	paths_bytes    = 0;
+	paths_hits     = 0;
+	paths_misses   = 0;
+	paths_lock.unlock();
+}
+
+///////////////////////////////////////////
+
+uint64_t paths_hash_path(XrPath path) {
+	// XrPaths are often small sequential numbers, so they get mixed up
+	// before picking a slot.
+	uint64_t hash = path;
+	hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+	hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+	return hash ^ (hash >> 31);
+}
+
+///////////////////////////////////////////
+
+int32_t paths_find_path(XrPath path) {
+	if (paths_capacity == 0) return -1;
+	uint32_t mask = paths_capacity - 1;
+	for (uint32_t slot = paths_hash_path(path) & mask; paths_by_path[slot] != 0; slot = (slot + 1) & mask) {
+		int32_t index = paths_by_path[slot] - 1;
+		if (paths_entries[index].path == path) return index;
+	}
+	return -1;
+}
+
+///////////////////////////////////////////
+
+int32_t paths_find_str(const char *str, uint64_t hash) {
+	if (paths_capacity == 0) return -1;
+	uint32_t mask = paths_capacity - 1;
+	for (uint32_t slot = hash & mask; paths_by_str[slot] != 0; slot = (slot + 1) & mask) {
+		int32_t index = paths_by_str[slot] - 1;
+		if (paths_entries[index].str_hash == hash && strcmp(paths_entries[index].str, str) == 0) return index;
+	}
+	return -1;
+}
+
+///////////////////////////////////////////
+
+void paths_insert(const paths_entry_t *entry) {
+	// Kept under half full, so probes stay short
+	if ((paths_entries.count + 1) * 2 > paths_capacity)
+		paths_grow();
+
+	int32_t index = (int32_t)paths_entries.add(*entry);
+	if (entry->has_path) paths_slot_add(paths_by_path, paths_hash_path(entry->path), index);
+	if (entry->has_str ) paths_slot_add(paths_by_str,  entry->str_hash,              index);
+}
+
+///////////////////////////////////////////
+
+void paths_slot_add(int32_t *table, uint64_t hash, int32_t index) {
+	uint32_t mask = paths_capacity - 1;
+	uint32_t slot = hash & mask;
+	while (table[slot] != 0) slot = (slot + 1) & mask;
+	table[slot] = index + 1;
+}
+
+///////////////////////////////////////////
+
+void paths_grow() {
+	free(paths_by_path);
+	free(paths_by_str);
+	paths_capacity = paths_capacity == 0 ? 64 : paths_capacity * 2;
+	paths_by_path  = (int32_t *)calloc(paths_capacity, sizeof(int32_t));
+	paths_by_str   = (int32_t *)calloc(paths_capacity, sizeof(int32_t));
+
+	for (size_t i = 0; i < paths_entries.count; i++) {
+		const paths_entry_t *entry = &paths_entries[i];
+		if (entry->has_path) paths_slot_add(paths_by_path, paths_hash_path(entry->path), (int32_t)i);
+		if (entry->has_str ) paths_slot_add(paths_by_str,  entry->str_hash,              (int32_t)i);
+	}
+}
+
+///////////////////////////////////////////
+
+const char *paths_copy(const char *str, size_t len) {
+	if (paths_blocks == nullptr || paths_blocks->used + len + 1 > paths_blocks->size) {
+		size_t         size  = len + 1 > paths_block_size ? len + 1 : paths_block_size;
+		paths_block_t *block = (paths_block_t *)malloc(sizeof(paths_block_t) + size);
+		block->next = paths_blocks;
+		block->used = 0;
+		block->size = size;
+		paths_blocks = block;
+	}
+	char *result = (char *)(paths_blocks + 1) + paths_blocks->used;
+	memcpy(result, str, len);
+	result[len] = '\0';
+	paths_blocks->used += len + 1;
+	paths_bytes        += len + 1;
+	return result;
+}
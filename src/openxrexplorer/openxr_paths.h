@@ -0,0 +1,30 @@
+#pragma once
+
+#include <openxr/openxr.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// Caches XrPath <-> string both ways for the current instance, so a path
+// only ever costs one trip to the runtime. Strings live until paths_clear,
+// which needs doing before the instance is destroyed, since XrPath values
+// mean nothing past that. Safe to call from any thread.
+
+/*** Types *******************************/
+
+struct paths_stats_t {
+	int32_t  count;
+	uint64_t hits;
+	uint64_t misses;
+	size_t   string_bytes;
+};
+
+/*** Signatures **************************/
+
+// Looks up everything that isn't cached yet in one go, for when a whole
+// list of paths is about to be turned into strings.
+void          paths_resolve    (const XrPath *paths, int32_t count);
+// Returns the result's name if the runtime couldn't make a string of it.
+const char   *paths_to_string  (XrPath path);
+XrResult      paths_from_string(const char *path_string, XrPath *out_path);
+paths_stats_t paths_stats      ();
+void          paths_clear      ();
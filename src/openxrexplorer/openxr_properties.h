@@ -2,4 +2,6 @@
 
 #include <openxr/openxr.h>
 
-void openxr_load_system_properties(XrInstance xr_instance, XrSystemId xr_system_id);
\ No newline at end of file
+void        openxr_load_system_properties(XrInstance xr_instance, XrSystemId xr_system_id, XrFormFactor form);
+// The properties structs there's a table for, null past the end
+const char *openxr_properties_type       (int32_t index);
\ No newline at end of file
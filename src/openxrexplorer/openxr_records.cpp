@@ -0,0 +1,175 @@
+#include "openxr_records.h"
+#include "openxr_paths.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*** Signatures **************************/
+
+void records_add(xr_records_t *ref_records, uint64_t value);
+
+/*** Code ********************************/
+
+void records_column(xr_records_t *ref_records, const char *header, record_type_ type, const char *(*enum_name)(int64_t value)) {
+	const int32_t max = sizeof(ref_records->columns) / sizeof(ref_records->columns[0]);
+	if (ref_records->column_count >= max) return;
+
+	record_column_t *column = &ref_records->columns[ref_records->column_count];
+	column->header    = header;
+	column->type      = type;
+	column->enum_name = enum_name;
+	ref_records->column_count += 1;
+}
+
+///////////////////////////////////////////
+
+void records_add_string(xr_records_t *ref_records, const char *text) {
+	if (text == nullptr) text = "";
+
+	// Offsets rather than pointers, since the buffer moves as it grows
+	array_t<char> *buffer = &ref_records->text;
+	size_t         offset = buffer->count;
+	size_t         length = strlen(text) + 1;
+	if (buffer->count + length > buffer->capacity) {
+		size_t capacity = buffer->capacity == 0 ? 256 : buffer->capacity * 2;
+		while (capacity < buffer->count + length) capacity *= 2;
+		buffer->resize(capacity);
+	}
+	memcpy(buffer->data + buffer->count, text, length);
+	buffer->count += length;
+
+	records_add(ref_records, offset);
+}
+
+///////////////////////////////////////////
+
+void records_add_path(xr_records_t *ref_records, XrPath path) {
+	records_add(ref_records, path);
+}
+
+///////////////////////////////////////////
+
+void records_add_bool(xr_records_t *ref_records, bool value) {
+	records_add(ref_records, value ? 1 : 0);
+}
+
+///////////////////////////////////////////
+
+void records_add_number(xr_records_t *ref_records, double value) {
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	records_add(ref_records, bits);
+}
+
+///////////////////////////////////////////
+
+void records_add_enum(xr_records_t *ref_records, int64_t value) {
+	records_add(ref_records, (uint64_t)value);
+}
+
+///////////////////////////////////////////
+
+void records_add(xr_records_t *ref_records, uint64_t value) {
+	if (ref_records->column_count == 0) return;
+
+	// Whichever column is behind the first one is next, or the first one
+	// when the row is full.
+	int32_t column = 0;
+	for (int32_t c = 1; c < ref_records->column_count; c++) {
+		if (ref_records->values[c].count < ref_records->values[0].count) { column = c; break; }
+	}
+	ref_records->values[column].add(value);
+}
+
+///////////////////////////////////////////
+
+int32_t records_row_count(const xr_records_t *records) {
+	if (records->column_count == 0) return 0;
+	// A half finished row doesn't count
+	return (int32_t)records->values[records->column_count - 1].count;
+}
+
+///////////////////////////////////////////
+
+void records_clear(xr_records_t *ref_records) {
+	for (int32_t c = 0; c < ref_records->column_count; c++)
+		ref_records->values[c].clear();
+	ref_records->text.clear();
+}
+
+///////////////////////////////////////////
+
+void records_free(xr_records_t *ref_records) {
+	for (int32_t c = 0; c < ref_records->column_count; c++)
+		ref_records->values[c].free();
+	ref_records->text.free();
+	*ref_records = {};
+}
+
+///////////////////////////////////////////
+
+void records_to_table(const xr_records_t *records, display_table_t *ref_table) {
+	int32_t rows = records_row_count(records);
+
+	ref_table->column_count = records->column_count;
+	ref_table->header_row   = true;
+	for (int32_t c = 0; c < records->column_count; c++) {
+		ref_table->cols     [c].add({ records->columns[c].header });
+		ref_table->col_types[c] = records->columns[c].type;
+	}
+
+	// Paths from every column go to the runtime together
+	array_t<XrPath> paths = {};
+	for (int32_t c = 0; c < records->column_count; c++) {
+		if (records->columns[c].type != record_type_path) continue;
+		for (int32_t r = 0; r < rows; r++) paths.add(records->values[c][r]);
+	}
+	paths_resolve(paths.data, (int32_t)paths.count);
+	paths.free();
+
+	// Strings and numbers are copied into the table's own block, so it
+	// doesn't care what happens to the records after this. First pass
+	// sizes it, second pass fills it.
+	char   number[32];
+	size_t size = 0;
+	for (int32_t c = 0; c < records->column_count; c++) {
+		for (int32_t r = 0; r < rows; r++) {
+			uint64_t value = records->values[c][r];
+			double   as_number;
+			switch (records->columns[c].type) {
+			case record_type_string: size += strlen(records->text.data + value) + 1; break;
+			case record_type_number: memcpy(&as_number, &value, sizeof(as_number)); size += snprintf(number, sizeof(number), "%.15g", as_number) + 1; break;
+			default: break;
+			}
+		}
+	}
+	free(ref_table->cell_text);
+	ref_table->cell_text = size > 0 ? (char *)malloc(size) : nullptr;
+
+	char *at = ref_table->cell_text;
+	for (int32_t r = 0; r < rows; r++) {
+		for (int32_t c = 0; c < records->column_count; c++) {
+			const record_column_t *column = &records->columns[c];
+			uint64_t    value = records->values[c][r];
+			const char *text  = "";
+			double      as_number;
+			switch (column->type) {
+			case record_type_string: {
+				size_t length = strlen(records->text.data + value) + 1;
+				memcpy(at, records->text.data + value, length);
+				text = at;
+				at  += length;
+			} break;
+			case record_type_number:
+				memcpy(&as_number, &value, sizeof(as_number));
+				text = at;
+				at  += snprintf(at, sizeof(number), "%.15g", as_number) + 1;
+				break;
+			case record_type_path: text = paths_to_string((XrPath)value); break;
+			case record_type_bool: text = value ? "True" : "False"; break;
+			case record_type_enum: text = column->enum_name ? column->enum_name((int64_t)value) : "N/A"; break;
+			}
+			ref_table->cols[c].add({ text });
+		}
+	}
+}
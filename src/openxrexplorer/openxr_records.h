@@ -0,0 +1,28 @@
+#pragma once
+
+#include "openxr_info.h"
+
+// Typed rows for misc enums that have more than one thing to say per item,
+// like a tracker's persistent and role paths. Columns are set up once when
+// the enum is registered, then each load adds a whole row at a time, one
+// value per column in order.
+
+/*** Signatures **************************/
+
+void records_column(xr_records_t *ref_records, const char *header, record_type_ type, const char *(*enum_name)(int64_t value) = nullptr);
+
+void records_add_string(xr_records_t *ref_records, const char *text);
+void records_add_path  (xr_records_t *ref_records, XrPath path);
+void records_add_bool  (xr_records_t *ref_records, bool value);
+void records_add_number(xr_records_t *ref_records, double value);
+void records_add_enum  (xr_records_t *ref_records, int64_t value);
+
+int32_t records_row_count(const xr_records_t *records);
+// Drops the rows, but keeps the columns.
+void    records_clear    (xr_records_t *ref_records);
+void    records_free     (xr_records_t *ref_records);
+
+// Fills a table's columns with a header row and then the records as text.
+// Paths are all resolved in one go, and whatever text needs making goes
+// into a single block on the table, see display_table_t::cell_text.
+void records_to_table(const xr_records_t *records, display_table_t *ref_table);
@@ -0,0 +1,84 @@
+#include "openxr_reflect.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*** Signatures **************************/
+
+const char *reflect_value(const reflect_member_t *member, const uint8_t *at);
+
+/*** Code ********************************/
+
+void reflect_rows(display_table_t *ref_table, const char *prefix, const reflect_struct_t *desc, const void *data) {
+	for (int32_t m = 0; m < desc->member_count; m++) {
+		const reflect_member_t *member = &desc->members[m];
+		if (member->kind == reflect_kind_skip) continue;
+
+		const char *name  = prefix ? new_string("%s.%s", prefix, member->name) : member->name;
+		bool        whole = member->kind == reflect_kind_string || member->kind == reflect_kind_bytes;
+		uint32_t    count = whole ? 1 : member->count;
+		for (uint32_t i = 0; i < count; i++) {
+			const uint8_t *at        = (const uint8_t *)data + member->offset + i * member->size;
+			const char    *item_name = count > 1 ? new_string("%s[%u]", name, i) : name;
+			if (member->kind == reflect_kind_struct) {
+				reflect_rows(ref_table, item_name, member->child, at);
+			} else {
+				ref_table->cols[0].add({ item_name });
+				ref_table->cols[1].add({ reflect_value(member, at) });
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////
+
+const char *reflect_value(const reflect_member_t *member, const uint8_t *at) {
+	// Members can sit anywhere, so values are copied out rather than cast
+	int64_t  as_int  = 0;
+	uint64_t as_uint = 0;
+	double   as_float;
+	switch (member->kind) {
+	case reflect_kind_int:
+	case reflect_kind_enum:
+		switch (member->size) {
+		case 1: as_int = *(const int8_t *)at; break;
+		case 2: { int16_t v; memcpy(&v, at, 2); as_int = v; } break;
+		case 4: { int32_t v; memcpy(&v, at, 4); as_int = v; } break;
+		case 8: memcpy(&as_int, at, 8); break;
+		}
+		break;
+	case reflect_kind_bool:
+	case reflect_kind_uint:
+	case reflect_kind_hex:
+	case reflect_kind_handle:
+		memcpy(&as_uint, at, member->size < sizeof(as_uint) ? member->size : sizeof(as_uint));
+		break;
+	default: break;
+	}
+
+	switch (member->kind) {
+	case reflect_kind_bool:   return as_uint ? "True" : "False";
+	case reflect_kind_int:    return new_string("%lld", (long long)as_int);
+	case reflect_kind_uint:   return new_string("%llu", (unsigned long long)as_uint);
+	case reflect_kind_hex:    return new_string("0x%llx", (unsigned long long)as_uint);
+	case reflect_kind_handle: return as_uint ? new_string("0x%llx", (unsigned long long)as_uint) : "XR_NULL_HANDLE";
+	case reflect_kind_float:
+		if (member->size == sizeof(float)) { float v; memcpy(&v, at, sizeof(v)); as_float = v; }
+		else                               memcpy(&as_float, at, sizeof(as_float));
+		return new_string("%g", as_float);
+	case reflect_kind_string: return new_string("%.*s", (int32_t)member->count, (const char *)at);
+	case reflect_kind_bytes: {
+		// Bytes are mostly ids, like XrUuidEXT, so they go on one line
+		char *text = (char *)malloc(member->count * 2 + 1);
+		for (uint32_t i = 0; i < member->count; i++) snprintf(&text[i * 2], 3, "%02x", at[i]);
+		const char *result = new_string("%s", text);
+		free(text);
+		return result;
+	}
+	case reflect_kind_enum: {
+		const char *name = member->enum_name ? member->enum_name((int32_t)as_int) : nullptr;
+		return name ? name : new_string("%lld", (long long)as_int);
+	}
+	default: return "N/I";
+	}
+}
@@ -0,0 +1,207 @@
+#pragma once
+
+#include "openxr_info.h"
+#include "openxr_enums.h"
+
+#include <openxr/openxr_reflection.h>
+#include <stddef.h>
+#include <type_traits>
+
+#if __has_include("openxr_generated_properties.h")
+#include "openxr_generated_properties.h"
+#endif
+
+// Describes OpenXR structs as plain data, using the XR_LIST_STRUCT_ lists
+// from openxr_reflection.h. REFLECT_STRUCT builds a constexpr table of each
+// member's name, offset and kind, so every struct shares the one loop in
+// reflect_rows instead of getting code of its own. Structs need a
+// REFLECT_STRUCT before they can be shown by name, and enums need to be in
+// the enum tables, anything else shows up as "N/I".
+
+/*** Types *******************************/
+
+enum reflect_kind_ {
+	reflect_kind_skip,
+	reflect_kind_bool,
+	reflect_kind_int,
+	reflect_kind_uint,
+	reflect_kind_hex,
+	reflect_kind_float,
+	reflect_kind_string,
+	reflect_kind_bytes,
+	reflect_kind_enum,
+	reflect_kind_handle,
+	reflect_kind_struct,
+	reflect_kind_unknown,
+};
+
+struct reflect_struct_t;
+
+struct reflect_member_t {
+	const char             *name;
+	uint32_t                offset;
+	// Size of one element. Arrays have a count past 1, except for strings
+	// and bytes, which are shown whole.
+	uint32_t                size;
+	uint32_t                count;
+	reflect_kind_           kind;
+	const reflect_struct_t *child;
+	const char           *(*enum_name)(int32_t value);
+};
+
+struct reflect_struct_t {
+	const char             *name;
+	uint32_t                size;
+	const reflect_member_t *members;
+	int32_t                 member_count;
+};
+
+template <typename T> struct reflect_info_t      { static constexpr const reflect_struct_t *desc = nullptr; };
+template <typename T> struct reflect_enum_info_t { static constexpr const char *(*name)(int32_t) = nullptr; };
+
+/*** Signatures **************************/
+
+// Adds a name/value row to a two column table for each member of data,
+// which is a desc. Nested members get prefix and a dot on their names.
+void reflect_rows(display_table_t *ref_table, const char *prefix, const reflect_struct_t *desc, const void *data);
+
+/*** Code ********************************/
+
+// XrBool32 is only a uint32_t as far as the compiler knows, so which
+// members are bools comes from the registry. Struct and member names are
+// literals, so this is all worked out while compiling.
+#ifdef BOOL_MEMBERS_LIST
+
+struct reflect_bool_t {
+	const char *type;
+	const char *member;
+};
+
+#define REFLECT_BOOL(type, member) { #type, #member },
+constexpr reflect_bool_t reflect_bools[] = { BOOL_MEMBERS_LIST(REFLECT_BOOL) };
+#undef REFLECT_BOOL
+
+constexpr bool reflect_equals(const char *a, const char *b) {
+	return *a == *b && (*a == '\0' || reflect_equals(a + 1, b + 1));
+}
+constexpr bool reflect_is_bool(const char *type, const char *name) {
+	for (size_t i = 0; i < sizeof(reflect_bools) / sizeof(reflect_bools[0]); i++) {
+		if (reflect_equals(reflect_bools[i].type, type) && reflect_equals(reflect_bools[i].member, name)) return true;
+	}
+	return false;
+}
+
+#else
+
+// Without the registry, go by name. The spec names all of them as
+// capabilities, like supportsX or positionTracking.
+constexpr bool reflect_starts_with(const char *text, const char *start) {
+	return *start == '\0' || (*text == *start && reflect_starts_with(text + 1, start + 1));
+}
+constexpr bool reflect_ends_with(const char *text, const char *end, size_t text_len, size_t end_len) {
+	return end_len == 0 || (text_len > 0 && text[text_len-1] == end[end_len-1] && reflect_ends_with(text, end, text_len - 1, end_len - 1));
+}
+constexpr size_t reflect_strlen(const char *text) { return *text ? 1 + reflect_strlen(text + 1) : 0; }
+constexpr bool   reflect_is_bool(const char *type, const char *name) {
+	return reflect_starts_with(name, "support") || reflect_ends_with(name, "Tracking", reflect_strlen(name), 8);
+}
+
+#endif
+
+///////////////////////////////////////////
+
+template <typename M>
+constexpr reflect_kind_ reflect_kind(bool is_bool) {
+	typedef typename std::remove_extent<M>::type T;
+	// type and next are how OpenXR chains structs together, and already
+	// shown by the table's name.
+	if      constexpr (std::is_same<T, XrStructureType>::value) return reflect_kind_skip;
+	else if constexpr (std::is_same<T, void *>::value || std::is_same<T, const void *>::value) return reflect_kind_skip;
+	else if constexpr (std::is_array<M>::value && std::is_same<T, char>::value)    return reflect_kind_string;
+	else if constexpr (std::is_array<M>::value && std::is_same<T, uint8_t>::value) return reflect_kind_bytes;
+	else if constexpr (std::is_same<T, XrBool32>::value) return is_bool ? reflect_kind_bool : reflect_kind_uint;
+	// Flags, ids, and atoms are all 64 bit, and read best as hex
+	else if constexpr (std::is_same<T, uint64_t>::value) return reflect_kind_hex;
+	else if constexpr (std::is_floating_point<T>::value) return reflect_kind_float;
+	else if constexpr (std::is_enum<T>::value)           return reflect_kind_enum;
+	else if constexpr (std::is_integral<T>::value)       return std::is_signed<T>::value ? reflect_kind_int : reflect_kind_uint;
+	else if constexpr (std::is_pointer<T>::value)        return reflect_kind_handle;
+	else if constexpr (reflect_info_t<T>::desc != nullptr) return reflect_kind_struct;
+	else return reflect_kind_unknown;
+}
+
+///////////////////////////////////////////
+
+template <typename M>
+constexpr uint32_t reflect_count() {
+	return std::is_array<M>::value ? (uint32_t)std::extent<M>::value : 1;
+}
+
+///////////////////////////////////////////
+
+#define REFLECT_MEMBER(member) { \
+	#member, \
+	(uint32_t)offsetof(reflect_type, member), \
+	(uint32_t)sizeof(std::remove_extent<decltype(reflect_type::member)>::type), \
+	reflect_count<decltype(reflect_type::member)>(), \
+	reflect_kind <decltype(reflect_type::member)>(reflect_is_bool(reflect_type_name, #member)), \
+	reflect_info_t     <std::remove_extent<decltype(reflect_type::member)>::type>::desc, \
+	reflect_enum_info_t<std::remove_extent<decltype(reflect_type::member)>::type>::name },
+
+#define REFLECT_STRUCT(type, ...) \
+	struct reflect_##type##_t { \
+		typedef type reflect_type; \
+		static constexpr const char *reflect_type_name = #type; \
+		static constexpr reflect_member_t members[] = { XR_LIST_STRUCT_##type(REFLECT_MEMBER) }; \
+		static constexpr reflect_struct_t desc      = { #type, sizeof(type), members, sizeof(members) / sizeof(members[0]) }; \
+	}; \
+	template <> struct reflect_info_t<type> { static constexpr const reflect_struct_t *desc = &reflect_##type##_t::desc; };
+
+template <typename T> const char *reflect_enum_name(int32_t value) { return enums_name(enums_type_t<T>::id, value); }
+#define REFLECT_ENUM(type) \
+	template <> struct reflect_enum_info_t<type> { static constexpr const char *(*name)(int32_t) = reflect_enum_name<type>; };
+
+///////////////////////////////////////////
+
+// Structs that show up inside of other structs, and every enum the enum
+// tables know. Not every SDK version has every struct, so each is only
+// there if its list is. Nested structs need to come before anything that
+// holds them.
+
+ENUM_TYPES_LIST(REFLECT_ENUM)
+
+#ifdef XR_LIST_STRUCT_XrSystemGraphicsProperties
+REFLECT_STRUCT(XrSystemGraphicsProperties)
+#endif
+#ifdef XR_LIST_STRUCT_XrSystemTrackingProperties
+REFLECT_STRUCT(XrSystemTrackingProperties)
+#endif
+#ifdef XR_LIST_STRUCT_XrExtent2Di
+REFLECT_STRUCT(XrExtent2Di)
+#endif
+#ifdef XR_LIST_STRUCT_XrExtent2Df
+REFLECT_STRUCT(XrExtent2Df)
+#endif
+#ifdef XR_LIST_STRUCT_XrOffset2Di
+REFLECT_STRUCT(XrOffset2Di)
+#endif
+#ifdef XR_LIST_STRUCT_XrVector2f
+REFLECT_STRUCT(XrVector2f)
+#endif
+#ifdef XR_LIST_STRUCT_XrVector3f
+REFLECT_STRUCT(XrVector3f)
+#endif
+#ifdef XR_LIST_STRUCT_XrQuaternionf
+REFLECT_STRUCT(XrQuaternionf)
+#endif
+#ifdef XR_LIST_STRUCT_XrPosef
+REFLECT_STRUCT(XrPosef)
+#endif
+#ifdef XR_LIST_STRUCT_XrFovf
+REFLECT_STRUCT(XrFovf)
+#endif
+#ifdef XR_LIST_STRUCT_XrUuid
+REFLECT_STRUCT(XrUuid)
+#elif defined(XR_LIST_STRUCT_XrUuidEXT)
+REFLECT_STRUCT(XrUuidEXT)
+#endif
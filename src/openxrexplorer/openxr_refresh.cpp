@@ -0,0 +1,127 @@
+#include "openxr_refresh.h"
+#include "openxr_live.h"
+#include "openxr_dispatch.h"
+
+#include <math.h>
+
+#include <chrono>
+
+/*** Global Variables ********************/
+
+// A rate counts as settled once this many frames in a row are within
+// tolerance of it, both measured and predicted.
+const int32_t refresh_settle_frames    = 10;
+const double  refresh_settle_tolerance = 0.05;
+
+/*** Code ********************************/
+
+const char *refresh_validate(float duration_sec, array_t<const char *> *ref_items) {
+	typedef std::chrono::steady_clock clock;
+
+	if (xr_ext.xrEnumerateDisplayRefreshRatesFB == nullptr || xr_ext.xrRequestDisplayRefreshRateFB == nullptr || xr_ext.xrGetDisplayRefreshRateFB == nullptr)
+		return openxr_result_string(XR_ERROR_FUNCTION_UNSUPPORTED);
+
+	uint32_t count  = 0;
+	XrResult result = xr_ext.xrEnumerateDisplayRefreshRatesFB(xr_session, 0, &count, nullptr);
+	if (XR_FAILED(result)) return openxr_result_string(result);
+	array_t<float> rates(count, 0);
+	xr_ext.xrEnumerateDisplayRefreshRatesFB(xr_session, count, &count, rates.data);
+	rates.count = count;
+
+	result = live_session_begin();
+	if (XR_FAILED(result)) {
+		rates.free();
+		return openxr_result_string(result);
+	}
+
+	// Put things back how we found them afterwards
+	float original_rate = 0;
+	xr_ext.xrGetDisplayRefreshRateFB(xr_session, &original_rate);
+
+	ref_items->add("Advertised (Hz)");
+	ref_items->add("Measured (Hz)");
+	ref_items->add("Predicted (Hz)");
+	ref_items->add("Settle (ms)");
+	ref_items->add("Jitter p50/p95/p99 (ms)");
+	ref_items->add("Frames");
+
+	array_t<float> jitter = {};
+	for (size_t r = 0; r < rates.count && !live_cancelled(); r++) {
+		double period_ms = 1000.0 / rates[r];
+		ref_items->add(new_string("%g", rates[r]));
+
+		result = xr_ext.xrRequestDisplayRefreshRateFB(xr_session, rates[r]);
+		if (XR_FAILED(result)) {
+			ref_items->add(openxr_result_string(result));
+			for (int32_t i = 0; i < 4; i++) ref_items->add("");
+			continue;
+		}
+
+		// Wait for the new rate to take, or give up after the usual duration
+		// and measure whatever it's doing by then.
+		clock::time_point requested    = clock::now();
+		clock::time_point prev         = requested;
+		clock::time_point settle_start = requested;
+		int32_t           settled      = 0;
+		XrFrameState      state        = { XR_TYPE_FRAME_STATE };
+		for (int32_t frame = 0; settled < refresh_settle_frames && !live_cancelled(); frame++) {
+			if (std::chrono::duration<float>(clock::now() - requested).count() > duration_sec) break;
+			if (XR_FAILED(result = live_frame_begin(&state))) break;
+			clock::time_point now = clock::now();
+
+			double measured_ms  = std::chrono::duration<double, std::milli>(now - prev).count();
+			double predicted_ms = state.predictedDisplayPeriod / 1000000.0;
+			prev = now;
+			if (frame > 0 && fabs(measured_ms - period_ms) < period_ms * refresh_settle_tolerance && fabs(predicted_ms - period_ms) < period_ms * refresh_settle_tolerance) {
+				if (settled == 0) settle_start = now;
+				settled += 1;
+			} else {
+				settled = 0;
+			}
+			if (XR_FAILED(result = live_frame_end(&state, nullptr, 0))) break;
+			live_set_progress((r + 0.5f * std::chrono::duration<float>(now - requested).count() / duration_sec) / rates.count);
+		}
+
+		// Now measure it properly. Picks up from the last settling frame, so
+		// the first interval is a whole one.
+		jitter.clear();
+		double            predicted_total = 0;
+		int32_t           missed          = 0;
+		clock::time_point measure_start   = prev;
+		while (XR_SUCCEEDED(result) && !live_cancelled() && std::chrono::duration<float>(clock::now() - measure_start).count() < duration_sec) {
+			if (XR_FAILED(result = live_frame_begin(&state))) break;
+			clock::time_point now = clock::now();
+
+			double measured_ms = std::chrono::duration<double, std::milli>(now - prev).count();
+			prev = now;
+			jitter.add((float)fabs(measured_ms - period_ms));
+			predicted_total += state.predictedDisplayPeriod;
+			if (measured_ms > period_ms * 1.5) missed += 1;
+
+			result = live_frame_end(&state, nullptr, 0);
+			live_set_progress((r + 0.5f + 0.5f * std::chrono::duration<float>(now - measure_start).count() / duration_sec) / rates.count);
+		}
+		if (XR_FAILED(result)) {
+			ref_items->add(openxr_result_string(result));
+			for (int32_t i = 0; i < 4; i++) ref_items->add("");
+			break;
+		}
+
+		double elapsed = std::chrono::duration<double>(prev - measure_start).count();
+		jitter.sort();
+		ref_items->add(jitter.count > 0 ? new_string("%.2f", jitter.count / elapsed)                           : "N/A");
+		ref_items->add(jitter.count > 0 ? new_string("%.2f", 1000000000.0 / (predicted_total / jitter.count)) : "N/A");
+		ref_items->add(settled >= refresh_settle_frames ? new_string("%.1f", std::chrono::duration<double, std::milli>(settle_start - requested).count()) : "Didn't settle");
+		ref_items->add(new_string("%.2f / %.2f / %.2f",
+			live_percentile(jitter.data, (int32_t)jitter.count, 50),
+			live_percentile(jitter.data, (int32_t)jitter.count, 95),
+			live_percentile(jitter.data, (int32_t)jitter.count, 99)));
+		ref_items->add(new_string("%d (%d missed)", (int32_t)jitter.count, missed));
+	}
+
+	if (original_rate > 0)
+		xr_ext.xrRequestDisplayRefreshRateFB(xr_session, original_rate);
+	jitter.free();
+	rates .free();
+	return nullptr;
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "array.h"
+
+// Requests each rate xrEnumerateDisplayRefreshRatesFB advertises, and runs
+// the frame loop at it for duration_sec. Reports how often xrWaitFrame
+// actually returned, what predictedDisplayPeriod claimed, how long the
+// switch took to settle, and how far frames strayed from the advertised
+// period. A live test, so this runs on the live test thread.
+const char *refresh_validate(float duration_sec, array_t<const char *> *ref_items);
@@ -0,0 +1,272 @@
+#include "openxr_spec.h"
+#include "openxr_info.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/*** Global Variables ********************/
+
+bool                     spec_tried   = false;
+const uint8_t           *spec_data    = nullptr;
+size_t                   spec_size    = 0;
+const spec_file_entry_t *spec_entries = nullptr;
+const char              *spec_strings = nullptr;
+uint32_t                 spec_entry_count = 0;
+#if defined(_WIN32)
+HANDLE                   spec_mapping = nullptr;
+#endif
+
+/*** Signatures **************************/
+
+bool    spec_map  (const char *file);
+void    spec_unmap();
+bool    spec_check();
+int32_t spec_compare(const char *a, const char *b, size_t b_length);
+char    spec_lower  (char c);
+
+/*** Code ********************************/
+
+bool spec_load() {
+	if (spec_tried) return spec_data != nullptr;
+	spec_tried = true;
+
+	char   path[1024] = {};
+	size_t length     = openxr_exe_path(path, sizeof(path)) ? strlen(path) : 0;
+	while (length > 0 && path[length-1] != '\\' && path[length-1] != '/') length--;
+
+	// Next to the exe for builds, and the usual share folder for installs
+	const char *folders[] = { "", "../share/openxr-explorer/" };
+	for (size_t i = 0; i < sizeof(folders)/sizeof(folders[0]); i++) {
+		snprintf(&path[length], sizeof(path) - length, "%s%s", folders[i], spec_file_name);
+		if (!spec_map(path)) continue;
+		if (spec_check()) return true;
+
+		printf("Ignoring %s, it's not an index this version can read.\n", path);
+		spec_unmap();
+	}
+	return false;
+}
+
+///////////////////////////////////////////
+
+void spec_unload() {
+	spec_unmap();
+	spec_tried = false;
+}
+
+///////////////////////////////////////////
+
+bool spec_check() {
+	spec_file_header_t header = {};
+	if (spec_size < sizeof(header)) return false;
+	memcpy(&header, spec_data, sizeof(header));
+	if (memcmp(header.magic, spec_file_magic, sizeof(header.magic)) != 0 || header.version != spec_file_version)
+		return false;
+
+	size_t strings_at = sizeof(header) + (size_t)header.entry_count * sizeof(spec_file_entry_t);
+	if (header.string_size == 0 || strings_at + header.string_size > spec_size) return false;
+
+	// Everything past here points straight into the file, so make sure it
+	// can't point outside of it.
+	spec_entries     = (const spec_file_entry_t *)(spec_data + sizeof(header));
+	spec_strings     = (const char *)(spec_data + strings_at);
+	spec_entry_count = header.entry_count;
+	if (spec_strings[header.string_size - 1] != '\0') return false;
+	for (uint32_t i = 0; i < spec_entry_count; i++) {
+		const spec_file_entry_t *entry = &spec_entries[i];
+		if (entry->name >= header.string_size || entry->anchor >= header.string_size || entry->text >= header.string_size || entry->kind >= spec_kind_count)
+			return false;
+	}
+	return true;
+}
+
+///////////////////////////////////////////
+
+bool spec_find(const char *name, spec_entry_t *out_entry) {
+	if (!spec_load()) return false;
+
+	size_t  name_length = strlen(name);
+	int32_t lo = 0, hi = (int32_t)spec_entry_count - 1;
+	while (lo <= hi) {
+		int32_t mid = lo + (hi - lo) / 2;
+		int32_t cmp = spec_compare(spec_strings + spec_entries[mid].name, name, name_length);
+		if (cmp == 0 && spec_strings[spec_entries[mid].name + name_length] == '\0') {
+			*out_entry = spec_get(mid);
+			return true;
+		}
+		// A 0 here means name is only the start of this one, so it's after
+		if (cmp < 0) lo = mid + 1;
+		else         hi = mid - 1;
+	}
+	return false;
+}
+
+///////////////////////////////////////////
+
+int32_t spec_search(const char *query, int32_t *out_indices, int32_t max_indices) {
+	if (!spec_load() || max_indices <= 0) return 0;
+
+	// Sorted names put everything starting with the query in one run
+	size_t  query_length = strlen(query);
+	int32_t lo = 0, hi = (int32_t)spec_entry_count;
+	while (lo < hi) {
+		int32_t mid = lo + (hi - lo) / 2;
+		if (spec_compare(spec_strings + spec_entries[mid].name, query, query_length) < 0) lo = mid + 1;
+		else                                                                              hi = mid;
+	}
+	int32_t count = 0;
+	for (int32_t i = lo; i < (int32_t)spec_entry_count && count < max_indices; i++) {
+		if (spec_compare(spec_strings + spec_entries[i].name, query, query_length) != 0) break;
+		out_indices[count++] = i;
+	}
+	if (query_length == 0) return count;
+
+	// Then anything with it in the middle, which is a plain scan, but it's
+	// only a few thousand short names.
+	for (uint32_t i = 0; i < spec_entry_count && count < max_indices; i++) {
+		const char *name = spec_strings + spec_entries[i].name;
+		if (spec_compare(name, query, query_length) == 0) continue;
+		for (const char *at = name + 1; *at; at++) {
+			if (spec_compare(at, query, query_length) == 0) {
+				out_indices[count++] = (int32_t)i;
+				break;
+			}
+		}
+	}
+	return count;
+}
+
+///////////////////////////////////////////
+
+spec_entry_t spec_get(int32_t index) {
+	const spec_file_entry_t *entry = &spec_entries[index];
+	return spec_entry_t{
+		spec_strings + entry->name,
+		spec_strings + entry->anchor,
+		spec_strings + entry->text,
+		(spec_kind_)entry->kind };
+}
+
+///////////////////////////////////////////
+
+int32_t spec_count() {
+	return spec_load() ? (int32_t)spec_entry_count : 0;
+}
+
+///////////////////////////////////////////
+
+const char *spec_kind_name(spec_kind_ kind) {
+	switch (kind) {
+	case spec_kind_type:      return "Type";
+	case spec_kind_struct:    return "Struct";
+	case spec_kind_enum:      return "Enum";
+	case spec_kind_value:     return "Value";
+	case spec_kind_command:   return "Function";
+	case spec_kind_extension: return "Extension";
+	case spec_kind_version:   return "Version";
+	default:                  return "";
+	}
+}
+
+///////////////////////////////////////////
+
+char spec_lower(char c) {
+	return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+}
+
+///////////////////////////////////////////
+
+int32_t spec_compare(const char *a, const char *b, size_t b_length) {
+	// Compares a's first b_length characters with b, ignoring case, the
+	// same order xrgenerator sorts the entries in.
+	for (size_t i = 0; i < b_length; i++) {
+		int32_t d = (uint8_t)spec_lower(a[i]) - (uint8_t)spec_lower(b[i]);
+		if (d != 0 || a[i] == '\0') return d;
+	}
+	return 0;
+}
+
+///////////////////////////////////////////
+
+#if defined(_WIN32)
+
+bool spec_map(const char *file) {
+	HANDLE handle = CreateFileA(file, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (handle == INVALID_HANDLE_VALUE) return false;
+
+	LARGE_INTEGER size = {};
+	if (!GetFileSizeEx(handle, &size) || size.QuadPart == 0) {
+		CloseHandle(handle);
+		return false;
+	}
+	// The mapping keeps the file open, so the handle isn't needed anymore
+	spec_mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(handle);
+	if (spec_mapping == nullptr) return false;
+
+	spec_data = (const uint8_t *)MapViewOfFile(spec_mapping, FILE_MAP_READ, 0, 0, 0);
+	spec_size = (size_t)size.QuadPart;
+	if (spec_data == nullptr) {
+		CloseHandle(spec_mapping);
+		spec_mapping = nullptr;
+		return false;
+	}
+	return true;
+}
+
+///////////////////////////////////////////
+
+void spec_unmap() {
+	if (spec_data)    UnmapViewOfFile(spec_data);
+	if (spec_mapping) CloseHandle(spec_mapping);
+	spec_mapping     = nullptr;
+	spec_data        = nullptr;
+	spec_size        = 0;
+	spec_entries     = nullptr;
+	spec_strings     = nullptr;
+	spec_entry_count = 0;
+}
+
+#else
+
+bool spec_map(const char *file) {
+	int fd = open(file, O_RDONLY);
+	if (fd < 0) return false;
+
+	struct stat info = {};
+	if (fstat(fd, &info) != 0 || info.st_size == 0) {
+		close(fd);
+		return false;
+	}
+	// The mapping holds onto the file, so the descriptor can go
+	void *data = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) return false;
+
+	spec_data = (const uint8_t *)data;
+	spec_size = (size_t)info.st_size;
+	return true;
+}
+
+///////////////////////////////////////////
+
+void spec_unmap() {
+	if (spec_data) munmap((void *)spec_data, spec_size);
+	spec_data        = nullptr;
+	spec_size        = 0;
+	spec_entries     = nullptr;
+	spec_strings     = nullptr;
+	spec_entry_count = 0;
+}
+
+#endif
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// An offline copy of what the registry says about each struct, enum, value,
+// function and extension, so spec links still work without a network. It's
+// compiled from xr.xml by xrgenerator, and memory mapped here, so opening it
+// costs nothing and lookups are a binary search over the mapped file.
+//
+// The registry only has the API's shape (declarations, error codes, who
+// added what) and short comments, the spec's prose isn't in there.
+
+/*** Types *******************************/
+
+enum spec_kind_ {
+	spec_kind_type,
+	spec_kind_struct,
+	spec_kind_enum,
+	spec_kind_value,
+	spec_kind_command,
+	spec_kind_extension,
+	spec_kind_version,
+	spec_kind_count,
+};
+
+// On-disk layout, little endian. Names, anchors and text are all offsets
+// into the string block, and entries are sorted by their lower case name.
+//
+// [spec_file_header_t]
+// [spec_file_entry_t] * entry_count
+// [strings, null terminated] string_size bytes
+struct spec_file_header_t {
+	char     magic[8];
+	uint32_t version;
+	uint32_t entry_count;
+	uint32_t string_size;
+	uint32_t reserved;
+};
+
+struct spec_file_entry_t {
+	uint32_t name;
+	uint32_t anchor; // Where it is in the online spec
+	uint32_t text;
+	uint32_t kind;
+};
+
+struct spec_entry_t {
+	const char *name;
+	const char *anchor;
+	const char *text;
+	spec_kind_  kind;
+};
+
+const char     spec_file_magic[8] = { 'X','R','S','P','E','C','\0','\0' };
+const uint32_t spec_file_version  = 1;
+const char     spec_file_name[]   = "openxr_spec.idx";
+
+/*** Signatures **************************/
+
+// Looks next to the executable, then in ../share/openxr-explorer. Only
+// looks once, so it's fine to call this every frame.
+bool         spec_load  ();
+void         spec_unload();
+
+// Exact names, ignoring case
+bool         spec_find  (const char *name, spec_entry_t *out_entry);
+// Names that start with query come first, then names that contain it.
+// Returns how many indices were written.
+int32_t      spec_search(const char *query, int32_t *out_indices, int32_t max_indices);
+spec_entry_t spec_get   (int32_t index);
+int32_t      spec_count ();
+const char  *spec_kind_name(spec_kind_ kind);
@@ -0,0 +1,179 @@
+#include "openxr_swapchain.h"
+#include "openxr_live.h"
+
+#if defined(__linux__)
+#include <GL/glxew.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
+
+#include <openxr/openxr_platform.h>
+
+#include <chrono>
+
+/*** Types *******************************/
+
+#if defined(XR_USE_GRAPHICS_API_D3D11)
+typedef XrSwapchainImageD3D11KHR swapchain_image_t;
+const XrStructureType swapchain_image_type = XR_TYPE_SWAPCHAIN_IMAGE_D3D11_KHR;
+#else
+typedef XrSwapchainImageOpenGLKHR swapchain_image_t;
+const XrStructureType swapchain_image_type = XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_KHR;
+#endif
+
+struct swapchain_size_t {
+	uint32_t width;
+	uint32_t height;
+};
+
+/*** Global Variables ********************/
+
+// Enough for solid percentiles, and keeps a slow runtime from dragging on
+const int32_t swapchain_max_cycles = 10000;
+const XrDuration swapchain_wait_ns = 100000000;
+
+/*** Signatures **************************/
+
+void swapchain_measure(int64_t format, swapchain_size_t size, float duration_sec, array_t<const char *> *ref_items);
+
+/*** Code ********************************/
+
+const char *swapchain_benchmark(float duration_sec, array_t<const char *> *ref_items) {
+	uint32_t count  = 0;
+	XrResult result = xrEnumerateSwapchainFormats(xr_session, 0, &count, nullptr);
+	if (XR_FAILED(result)) return openxr_result_string(result);
+	array_t<int64_t> formats(count, 0);
+	xrEnumerateSwapchainFormats(xr_session, count, &count, formats.data);
+
+	// Stereo views are usually the same size, so only distinct ones count
+	array_t<swapchain_size_t> sizes = {};
+	for (size_t c = 0; c < xr_view.configs.count; c++) {
+		const xr_view_config_info_t *config = &xr_view.configs[c];
+		if (config->form != xr_settings.form || config->type != live_view_config) continue;
+		for (size_t v = 0; v < config->views.count; v++) {
+			swapchain_size_t size = { config->views[v].recommendedImageRectWidth, config->views[v].recommendedImageRectHeight };
+			if (size.width == 0 || size.height == 0) continue;
+			bool found = false;
+			for (size_t s = 0; s < sizes.count; s++) {
+				if (sizes[s].width == size.width && sizes[s].height == size.height) found = true;
+			}
+			if (!found) sizes.add(size);
+		}
+	}
+	if (formats.count == 0 || sizes.count == 0) {
+		formats.free();
+		sizes  .free();
+		return formats.count == 0 ? "No swapchain formats" : "No recommended view sizes";
+	}
+
+	ref_items->add("Format");
+	ref_items->add("Size");
+	ref_items->add("Create (ms)");
+	ref_items->add("Images (enumerate ms)");
+	ref_items->add("Acquire/wait/release p50/p99 (us)");
+	ref_items->add("Failures");
+
+	float  per_swapchain = duration_sec / (formats.count * sizes.count);
+	size_t total         = formats.count * sizes.count;
+	for (size_t f = 0; f < formats.count && !live_cancelled(); f++) {
+		for (size_t s = 0; s < sizes.count && !live_cancelled(); s++) {
+			live_set_progress((float)(f * sizes.count + s) / total);
+			swapchain_measure(formats[f], sizes[s], per_swapchain, ref_items);
+		}
+	}
+
+	formats.free();
+	sizes  .free();
+	return nullptr;
+}
+
+///////////////////////////////////////////
+
+void swapchain_measure(int64_t format, swapchain_size_t size, float duration_sec, array_t<const char *> *ref_items) {
+	ref_items->add(openxr_format_name(format));
+	ref_items->add(new_string("%ux%u", size.width, size.height));
+
+	skg_tex_fmt_ skg_format = skg_tex_fmt_from_native(format);
+	bool         depth      = skg_format == skg_tex_fmt_depthstencil || skg_format == skg_tex_fmt_depth32 || skg_format == skg_tex_fmt_depth16;
+
+	XrSwapchainCreateInfo info = { XR_TYPE_SWAPCHAIN_CREATE_INFO };
+	info.usageFlags  = depth
+		? XR_SWAPCHAIN_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT
+		: XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT | XR_SWAPCHAIN_USAGE_SAMPLED_BIT;
+	info.format      = format;
+	info.sampleCount = 1;
+	info.width       = size.width;
+	info.height      = size.height;
+	info.faceCount   = 1;
+	info.arraySize   = 1;
+	info.mipCount    = 1;
+
+	XrSwapchain swapchain = XR_NULL_HANDLE;
+	auto        start     = std::chrono::steady_clock::now();
+	XrResult    result    = xrCreateSwapchain(xr_session, &info, &swapchain);
+	float       create_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+	if (XR_FAILED(result)) {
+		ref_items->add(openxr_result_string(result));
+		ref_items->add("");
+		ref_items->add("");
+		ref_items->add("");
+		return;
+	}
+	ref_items->add(new_string("%.2f", create_ms));
+
+	// Both calls, since that's what every app does
+	uint32_t image_count = 0;
+	start  = std::chrono::steady_clock::now();
+	result = xrEnumerateSwapchainImages(swapchain, 0, &image_count, nullptr);
+	array_t<swapchain_image_t> images(image_count, { swapchain_image_type });
+	if (XR_SUCCEEDED(result))
+		result = xrEnumerateSwapchainImages(swapchain, image_count, &image_count, (XrSwapchainImageBaseHeader *)images.data);
+	float enumerate_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+	ref_items->add(XR_FAILED(result)
+		? openxr_result_string(result)
+		: new_string("%u (%.3f)", image_count, enumerate_ms));
+	images.free();
+
+	array_t<float> cycles   = {};
+	int32_t        failures = 0;
+	XrResult       failure  = XR_SUCCESS;
+	start = std::chrono::steady_clock::now();
+	while (cycles.count + failures < swapchain_max_cycles && !live_cancelled()) {
+		auto cycle_start = std::chrono::steady_clock::now();
+		if (std::chrono::duration<float>(cycle_start - start).count() > duration_sec) break;
+
+		XrSwapchainImageAcquireInfo acquire_info = { XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO };
+		XrSwapchainImageWaitInfo    wait_info    = { XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO };
+		XrSwapchainImageReleaseInfo release_info = { XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO };
+		wait_info.timeout = swapchain_wait_ns;
+
+		uint32_t index = 0;
+		result = xrAcquireSwapchainImage(swapchain, &acquire_info, &index);
+		if (XR_FAILED(result)) { failures++; failure = result; break; }
+		// A timeout leaves the image acquired, and it can't be released
+		// until a wait succeeds, so timeouts count and then wait again.
+		XrResult wait = xrWaitSwapchainImage(swapchain, &wait_info);
+		while (wait == XR_TIMEOUT_EXPIRED && !live_cancelled()) {
+			failures++;
+			failure = wait;
+			wait    = xrWaitSwapchainImage(swapchain, &wait_info);
+		}
+		if (wait != XR_SUCCESS) { failures++; failure = wait; break; }
+		result = xrReleaseSwapchainImage(swapchain, &release_info);
+		if (XR_FAILED(result)) { failures++; failure = result; break; }
+
+		cycles.add(std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - cycle_start).count());
+	}
+	xrDestroySwapchain(swapchain);
+
+	cycles.sort();
+	ref_items->add(cycles.count == 0
+		? "None"
+		: new_string("%.1f / %.1f",
+			live_percentile(cycles.data, (int32_t)cycles.count, 50),
+			live_percentile(cycles.data, (int32_t)cycles.count, 99)));
+	ref_items->add(failures == 0
+		? "0"
+		: new_string("%d (%s)", failures, openxr_result_string(failure)));
+	cycles.free();
+}
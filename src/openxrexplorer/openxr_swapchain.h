@@ -0,0 +1,10 @@
+#pragma once
+
+#include "array.h"
+
+// Creates a swapchain for each format the session supports, at each
+// recommended view size, and times xrCreateSwapchain,
+// xrEnumerateSwapchainImages, and a loop of acquire/wait/release. No frame
+// loop needed. A live test, duration is split between the swapchains, and
+// it has to run on the thread with the graphics context.
+const char *swapchain_benchmark(float duration_sec, array_t<const char *> *ref_items);
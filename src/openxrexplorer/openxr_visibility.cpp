@@ -0,0 +1,119 @@
+#include "openxr_visibility.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/*** Signatures **************************/
+
+void visibility_bounds(const XrVector2f *verts, uint32_t vert_count, XrVector2f *ref_min, XrVector2f *ref_max);
+
+/*** Code ********************************/
+
+int64_t visibility_rasterize(const XrVector2f *verts, uint32_t vert_count, const uint32_t *inds, uint32_t ind_count, XrVector2f min, XrVector2f max, int32_t width, int32_t height, uint8_t *ref_mask) {
+	const float scale_x = width  / (max.x - min.x);
+	const float scale_y = height / (max.y - min.y);
+
+	for (uint32_t i = 0; i + 2 < ind_count; i += 3) {
+		if (inds[i] >= vert_count || inds[i+1] >= vert_count || inds[i+2] >= vert_count)
+			continue;
+
+		// Into pixel space, with y going down the image
+		XrVector2f p[3];
+		for (int32_t v = 0; v < 3; v++) {
+			p[v].x = (verts[inds[i+v]].x - min.x) * scale_x;
+			p[v].y = (max.y - verts[inds[i+v]].y) * scale_y;
+		}
+
+		// Sort top to bottom, so the triangle splits into a long edge on one
+		// side, and two short edges on the other.
+		XrVector2f t;
+		if (p[1].y < p[0].y) { t = p[0]; p[0] = p[1]; p[1] = t; }
+		if (p[2].y < p[1].y) { t = p[1]; p[1] = p[2]; p[2] = t; }
+		if (p[1].y < p[0].y) { t = p[0]; p[0] = p[1]; p[1] = t; }
+		if (p[2].y <= p[0].y) continue;
+
+		const float slope_long  = (p[2].x - p[0].x) / (p[2].y - p[0].y);
+		const float slope_upper = p[1].y > p[0].y ? (p[1].x - p[0].x) / (p[1].y - p[0].y) : 0;
+		const float slope_lower = p[2].y > p[1].y ? (p[2].x - p[1].x) / (p[2].y - p[1].y) : 0;
+
+		// Rows whose pixel centers are inside the triangle
+		int32_t row_start = (int32_t)ceilf(p[0].y - 0.5f);
+		int32_t row_end   = (int32_t)ceilf(p[2].y - 0.5f);
+		if (row_start < 0)      row_start = 0;
+		if (row_end   > height) row_end   = height;
+
+		for (int32_t y = row_start; y < row_end; y++) {
+			float center = y + 0.5f;
+			float x_long  = p[0].x + (center - p[0].y) * slope_long;
+			float x_short = center < p[1].y
+				? p[0].x + (center - p[0].y) * slope_upper
+				: p[1].x + (center - p[1].y) * slope_lower;
+			float left  = x_long < x_short ? x_long  : x_short;
+			float right = x_long < x_short ? x_short : x_long;
+
+			int32_t x_start = (int32_t)ceilf(left  - 0.5f);
+			int32_t x_end   = (int32_t)ceilf(right - 0.5f);
+			if (x_start < 0)     x_start = 0;
+			if (x_end   > width) x_end   = width;
+			if (x_end > x_start)
+				memset(&ref_mask[(size_t)y * width + x_start], 1, x_end - x_start);
+		}
+	}
+
+	// Spans are filled rather than counted, so overlaps don't count twice.
+	// This is a straight sum over bytes, which the compiler vectorizes.
+	int64_t covered = 0;
+	size_t  count   = (size_t)width * height;
+	for (size_t i = 0; i < count; i++)
+		covered += ref_mask[i];
+	return covered;
+}
+
+///////////////////////////////////////////
+
+float visibility_hidden_fraction(
+	const XrVector2f *hidden_verts,  uint32_t hidden_vert_count,  const uint32_t *hidden_inds,  uint32_t hidden_ind_count,
+	const XrVector2f *visible_verts, uint32_t visible_vert_count, const uint32_t *visible_inds, uint32_t visible_ind_count,
+	int32_t width, int32_t height) {
+
+	if (width <= 0 || height <= 0 || (hidden_ind_count < 3 && visible_ind_count < 3))
+		return -1;
+
+	// Mask vertices are in view space, and the image's extents there come
+	// from the view's FOV, which we don't have without a running session.
+	// Between them, the hidden and visible meshes cover the whole image, so
+	// their combined bounds stand in for it.
+	XrVector2f min = {  INFINITY,  INFINITY };
+	XrVector2f max = { -INFINITY, -INFINITY };
+	visibility_bounds(hidden_verts,  hidden_vert_count,  &min, &max);
+	visibility_bounds(visible_verts, visible_vert_count, &min, &max);
+	if (!(max.x > min.x) || !(max.y > min.y))
+		return -1;
+
+	uint8_t *mask = (uint8_t *)calloc((size_t)width * height, 1);
+	if (mask == nullptr)
+		return -1;
+
+	float result;
+	if (hidden_ind_count >= 3) {
+		int64_t covered = visibility_rasterize(hidden_verts, hidden_vert_count, hidden_inds, hidden_ind_count, min, max, width, height, mask);
+		result = (float)((double)covered / ((double)width * height));
+	} else {
+		int64_t covered = visibility_rasterize(visible_verts, visible_vert_count, visible_inds, visible_ind_count, min, max, width, height, mask);
+		result = 1 - (float)((double)covered / ((double)width * height));
+	}
+	free(mask);
+	return result;
+}
+
+///////////////////////////////////////////
+
+void visibility_bounds(const XrVector2f *verts, uint32_t vert_count, XrVector2f *ref_min, XrVector2f *ref_max) {
+	for (uint32_t i = 0; i < vert_count; i++) {
+		if (verts[i].x < ref_min->x) ref_min->x = verts[i].x;
+		if (verts[i].y < ref_min->y) ref_min->y = verts[i].y;
+		if (verts[i].x > ref_max->x) ref_max->x = verts[i].x;
+		if (verts[i].y > ref_max->y) ref_max->y = verts[i].y;
+	}
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <openxr/openxr.h>
+#include <stdint.h>
+
+// Fills every pixel of a width x height coverage mask whose center falls
+// inside one of the triangles. Vertices are mapped from the min/max
+// rectangle onto the image, with +y up like OpenXR's view space. The mask
+// must be zeroed by the caller. Returns how many pixels of the mask are
+// covered afterwards, so overlapping triangles aren't counted twice.
+int64_t visibility_rasterize(const XrVector2f *verts, uint32_t vert_count, const uint32_t *inds, uint32_t ind_count, XrVector2f min, XrVector2f max, int32_t width, int32_t height, uint8_t *ref_mask);
+
+// Works out what fraction of a width x height image a hidden area mesh
+// covers. If there's no hidden mesh, the visible mesh is used instead.
+// Returns a negative number if neither mesh has anything in it.
+float visibility_hidden_fraction(
+	const XrVector2f *hidden_verts,  uint32_t hidden_vert_count,  const uint32_t *hidden_inds,  uint32_t hidden_ind_count,
+	const XrVector2f *visible_verts, uint32_t visible_vert_count, const uint32_t *visible_inds, uint32_t visible_ind_count,
+	int32_t width, int32_t height);
@@ -0,0 +1,1071 @@
+// Reads the OpenXR registry (xr.xml) and writes the lists openxr-explorer
+// builds its tables from, along with the offline spec index. The registry
+// is a few MB, so it's read as a stream of tags rather than loaded into a
+// tree.
+//
+// Usage: xrgenerator <xr.xml> <output folder>
+
+#include "array.h"
+#include "openxr_spec.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+/*** Types *******************************/
+
+enum xml_event_ {
+	xml_event_end,
+	xml_event_open,
+	xml_event_close,
+	xml_event_text,
+};
+
+struct xml_attr_t {
+	char *name;
+	char *value;
+};
+
+struct xml_reader_t {
+	FILE   *file;
+	char    buffer[64 * 1024];
+	size_t  at;
+	size_t  count;
+
+	// Whatever the last event was about. Tag names, attributes and text all
+	// point into scratch, which the next event reuses.
+	array_t<char>       scratch;
+	array_t<xml_attr_t> attrs;
+	const char         *name;
+	const char         *text;
+	bool                self_closing;
+};
+
+struct gen_struct_t {
+	char *name;
+	char *structure_type;
+	bool  extends_properties;
+};
+
+// An XrBool32 member, which the compiler only sees as a uint32_t
+struct gen_bool_t {
+	char *type;
+	char *member;
+};
+
+struct gen_enum_t {
+	char *type;
+	char *name;
+	char *value;   // As the header would write it, or the aliased name
+	char *comment;
+	bool  alias;
+};
+
+struct gen_command_t {
+	char *extension;
+	char *name;
+};
+
+struct gen_extension_t {
+	char   *name;
+	char   *feature; // Core versions have this instead of a name
+	int32_t number;
+	bool    disabled;
+	bool    protect;
+	char   *spec;    // Summary for the spec index, from the attributes
+	array_t<char *> types;
+	array_t<char *> commands;
+	array_t<gen_enum_t> enums;
+};
+
+// Types and functions for the spec index. Where they come from is only
+// known once the extensions are read, so origin is usually worked out
+// while writing.
+struct gen_spec_t {
+	char      *name;
+	spec_kind_ kind;
+	char      *text;
+	char      *anchor; // nullptr when it's the name
+};
+
+/*** Global Variables ********************/
+
+array_t<gen_struct_t>    gen_structs    = {};
+array_t<gen_bool_t>      gen_bools      = {};
+array_t<gen_enum_t>      gen_enums      = {};
+array_t<char *>          gen_enum_types = {};
+array_t<char *>          gen_flag_types = {};
+array_t<gen_extension_t> gen_extensions = {};
+array_t<gen_spec_t>      gen_specs      = {};
+
+/*** Signatures **************************/
+
+bool        xml_open    (xml_reader_t *ref_reader, const char *file);
+void        xml_close   (xml_reader_t *ref_reader);
+xml_event_  xml_next    (xml_reader_t *ref_reader);
+const char *xml_attr    (const xml_reader_t *reader, const char *name);
+int32_t     xml_getc    (xml_reader_t *ref_reader);
+int32_t     xml_peekc   (xml_reader_t *ref_reader);
+void        xml_skip_to (xml_reader_t *ref_reader, const char *end);
+void        xml_decode  (array_t<char> *ref_text, size_t start);
+
+void        gen_read    (xml_reader_t *ref_reader);
+void        gen_read_type     (xml_reader_t *ref_reader, bool is_union);
+void        gen_read_decl     (xml_reader_t *ref_reader);
+void        gen_read_enums    (xml_reader_t *ref_reader, bool is_flags);
+void        gen_read_command  (xml_reader_t *ref_reader);
+void        gen_read_extension(xml_reader_t *ref_reader, gen_extension_t *ref_ext);
+gen_enum_t  gen_read_enum     (const xml_reader_t *reader, char *type, int32_t ext_number);
+
+const gen_extension_t *gen_find_extension(const char *type);
+const gen_extension_t *gen_find_command  (const char *command);
+bool        gen_available       (const char *type);
+
+bool        gen_write_properties(const char *folder);
+bool        gen_write_enums     (const char *folder);
+bool        gen_write_dispatch  (const char *folder);
+bool        gen_write_spec      (const char *folder);
+bool        gen_write_file      (const char *folder, const char *name, const array_t<char> *text);
+void        gen_printf          (array_t<char> *ref_text, const char *format, ...);
+void        gen_append_code     (array_t<char> *ref_text, const char *code);
+void        gen_append_list     (array_t<char> *ref_text, const char *label, const char *list);
+void        gen_append_origin   (array_t<char> *ref_text, const gen_extension_t *ext);
+char       *gen_finish          (array_t<char> *ref_text);
+char       *gen_copy            (const char *text);
+int32_t     gen_compare_nocase  (const char *a, const char *b);
+
+/*** Code ********************************/
+
+int main(int arg_count, const char **args) {
+	if (arg_count != 3) {
+		printf("Usage: xrgenerator <xr.xml> <output folder>\n");
+		return 1;
+	}
+
+	xml_reader_t *reader = (xml_reader_t *)calloc(1, sizeof(xml_reader_t));
+	if (!xml_open(reader, args[1])) {
+		printf("xrgenerator: couldn't open %s\n", args[1]);
+		free(reader);
+		return 1;
+	}
+	gen_read(reader);
+	xml_close(reader);
+	free(reader);
+
+	bool ok = gen_write_properties(args[2])
+	       && gen_write_enums     (args[2])
+	       && gen_write_dispatch  (args[2])
+	       && gen_write_spec      (args[2]);
+	printf("xrgenerator: %d properties structs, %d bool members, %d enum values, %d extensions, %d other types and functions\n",
+		(int32_t)gen_structs.count, (int32_t)gen_bools.count, (int32_t)gen_enums.count, (int32_t)gen_extensions.count, (int32_t)gen_specs.count);
+	// This is a short lived tool, so everything else is left to the OS
+	return ok ? 0 : 1;
+}
+
+///////////////////////////////////////////
+// Registry                              //
+///////////////////////////////////////////
+
+void gen_read(xml_reader_t *ref_reader) {
+	xml_event_ event;
+	while ((event = xml_next(ref_reader)) != xml_event_end) {
+		if (event != xml_event_open) continue;
+
+		if (strcmp(ref_reader->name, "type") == 0) {
+			const char *category = xml_attr(ref_reader, "category");
+			if (category == nullptr) continue;
+			bool is_struct = strcmp(category, "struct") == 0;
+			bool is_union  = strcmp(category, "union" ) == 0;
+			bool is_decl   =
+				strcmp(category, "handle"     ) == 0 ||
+				strcmp(category, "basetype"   ) == 0 ||
+				strcmp(category, "bitmask"    ) == 0 ||
+				strcmp(category, "funcpointer") == 0;
+
+			const char *alias = xml_attr(ref_reader, "alias");
+			if (alias && (is_struct || is_union || is_decl)) {
+				array_t<char> code = {};
+				gen_printf(&code, "Alias of %s\n", alias);
+				gen_specs.add({ gen_copy(xml_attr(ref_reader, "name")), is_struct ? spec_kind_struct : spec_kind_type, gen_finish(&code) });
+			} else if (!ref_reader->self_closing) {
+				if      (is_struct || is_union) gen_read_type(ref_reader, is_union);
+				else if (is_decl)               gen_read_decl(ref_reader);
+			}
+		} else if (strcmp(ref_reader->name, "enums") == 0) {
+			const char *type     = xml_attr(ref_reader, "type");
+			bool        is_enum  = type && strcmp(type, "enum"   ) == 0;
+			bool        is_flags = type && strcmp(type, "bitmask") == 0;
+			if ((is_enum || is_flags) && !ref_reader->self_closing)
+				gen_read_enums(ref_reader, is_flags);
+		} else if (strcmp(ref_reader->name, "command") == 0) {
+			gen_read_command(ref_reader);
+		} else if (strcmp(ref_reader->name, "extension") == 0 || strcmp(ref_reader->name, "feature") == 0) {
+			// Core versions list what they add the same way extensions do,
+			// they just don't have an extension name.
+			bool             is_ext    = ref_reader->name[0] == 'e';
+			const char      *supported = xml_attr(ref_reader, "supported");
+			const char      *number    = xml_attr(ref_reader, "number");
+			gen_extension_t  ext       = {};
+			ext.name     = is_ext ? gen_copy(xml_attr(ref_reader, "name")) : nullptr;
+			ext.feature  = is_ext ? nullptr : gen_copy(xml_attr(ref_reader, "name"));
+			ext.number   = is_ext && number ? atoi(number) : 0;
+			ext.disabled = supported && strcmp(supported, "disabled") == 0;
+			ext.protect  = xml_attr(ref_reader, "protect") != nullptr;
+
+			array_t<char> spec = {};
+			if (is_ext) {
+				const char *type = xml_attr(ref_reader, "type");
+				gen_printf(&spec, "Extension");
+				if (number) gen_printf(&spec, " #%s", number);
+				if (type  ) gen_printf(&spec, ", %s", type);
+				gen_printf(&spec, "\n");
+				struct field_t { const char *attr; const char *label; };
+				const field_t fields[] = {
+					{ "author",       "Author"        },
+					{ "contact",      "Contact"       },
+					{ "requires",     "Requires"      },
+					{ "depends",      "Depends on"    },
+					{ "promotedto",   "Promoted to"   },
+					{ "deprecatedby", "Deprecated by" },
+					{ "obsoletedby",  "Obsoleted by"  },
+					{ "protect",      "Only with"     } };
+				for (size_t f = 0; f < sizeof(fields)/sizeof(fields[0]); f++) {
+					const char *value = xml_attr(ref_reader, fields[f].attr);
+					if (value && value[0]) gen_printf(&spec, "%s: %s\n", fields[f].label, value);
+				}
+				const char *provisional = xml_attr(ref_reader, "provisional");
+				if (provisional && strcmp(provisional, "true") == 0)
+					gen_printf(&spec, "Provisional\n");
+			} else {
+				gen_printf(&spec, "Core API, version %s\n", number ? number : "?");
+			}
+			ext.spec = gen_finish(&spec);
+
+			if (!ref_reader->self_closing)
+				gen_read_extension(ref_reader, &ext);
+			gen_extensions.add(ext);
+		}
+	}
+}
+
+///////////////////////////////////////////
+
+void gen_read_type(xml_reader_t *ref_reader, bool is_union) {
+	gen_struct_t result = {};
+	result.name = gen_copy(xml_attr(ref_reader, "name"));
+	char *extends       = gen_copy(xml_attr(ref_reader, "structextends"));
+	bool  returned_only = xml_attr(ref_reader, "returnedonly") != nullptr;
+	// structextends is a comma separated list
+	if (extends) {
+		const char *found = strstr(extends, "XrSystemProperties");
+		result.extends_properties = found && (found[18] == '\0' || found[18] == ',');
+	}
+
+	// <member values="XR_TYPE_X"><type>XrStructureType</type> <name>type</name></member>
+	array_t<char> code = {};
+	gen_printf(&code, "typedef %s %s {\n", is_union ? "union" : "struct", result.name);
+	int32_t     depth         = 1;
+	int32_t     comment_depth = 0;
+	char       *member_values = nullptr;
+	char       *member_type   = nullptr;
+	char       *member_name   = nullptr;
+	bool        in_member     = false;
+	bool        in_name       = false;
+	bool        in_type       = false;
+	xml_event_  event;
+	while (depth > 0 && (event = xml_next(ref_reader)) != xml_event_end) {
+		if (event == xml_event_open) {
+			if (strcmp(ref_reader->name, "member") == 0) {
+				free(member_values);
+				free(member_type);
+				free(member_name);
+				member_values = gen_copy(xml_attr(ref_reader, "values"));
+				member_type   = nullptr;
+				member_name   = nullptr;
+				in_member     = true;
+				gen_printf(&code, "    ");
+			}
+			// Comments are notes for whoever writes the spec
+			if (strcmp(ref_reader->name, "comment") == 0 && !ref_reader->self_closing) comment_depth++;
+			in_name = strcmp(ref_reader->name, "name") == 0;
+			in_type = strcmp(ref_reader->name, "type") == 0;
+			if (!ref_reader->self_closing) depth++;
+		} else if (event == xml_event_close) {
+			if (strcmp(ref_reader->name, "comment") == 0) comment_depth--;
+			if (strcmp(ref_reader->name, "member" ) == 0) {
+				if (member_values) gen_printf(&code, "; // %s\n", member_values);
+				else               gen_printf(&code, ";\n");
+				if (member_type && member_name && strcmp(member_type, "XrBool32") == 0) {
+					gen_bools.add({ gen_copy(result.name), member_name });
+					member_name = nullptr;
+				}
+				in_member = false;
+			}
+			in_name = false;
+			in_type = false;
+			depth--;
+		} else if (event == xml_event_text) {
+			if (in_member && comment_depth == 0)
+				gen_append_code(&code, ref_reader->text);
+			if (in_member && comment_depth == 0 && in_type && member_type == nullptr) member_type = gen_copy(ref_reader->text);
+			if (in_member && comment_depth == 0 && in_name && member_name == nullptr) member_name = gen_copy(ref_reader->text);
+			if (in_name && strcmp(ref_reader->text, "type") == 0 && member_values && result.structure_type == nullptr)
+				result.structure_type = gen_copy(member_values);
+		}
+	}
+	free(member_values);
+	free(member_type);
+	free(member_name);
+
+	gen_printf(&code, "} %s;\n\n", result.name);
+	if (extends)       gen_append_list(&code, "Extends", extends);
+	if (returned_only) gen_printf(&code, "Only ever filled out by the runtime\n");
+	gen_specs.add({ gen_copy(result.name), spec_kind_struct, gen_finish(&code) });
+	free(extends);
+
+	if (result.extends_properties) gen_structs.add(result);
+	else { free(result.name); free(result.structure_type); }
+}
+
+///////////////////////////////////////////
+
+void gen_read_decl(xml_reader_t *ref_reader) {
+	// Handles, base types, flags and function pointers are each one C
+	// declaration, with the name somewhere in the middle of it.
+	char *name   = gen_copy(xml_attr(ref_reader, "name"));
+	char *parent = gen_copy(xml_attr(ref_reader, "parent"));
+
+	array_t<char> code          = {};
+	int32_t       depth         = 1;
+	int32_t       comment_depth = 0;
+	bool          in_name       = false;
+	xml_event_    event;
+	while (depth > 0 && (event = xml_next(ref_reader)) != xml_event_end) {
+		if (event == xml_event_open) {
+			if (strcmp(ref_reader->name, "comment") == 0 && !ref_reader->self_closing) comment_depth++;
+			in_name = strcmp(ref_reader->name, "name") == 0;
+			if (!ref_reader->self_closing) depth++;
+		} else if (event == xml_event_close) {
+			if (strcmp(ref_reader->name, "comment") == 0) comment_depth--;
+			in_name = false;
+			depth--;
+		} else if (event == xml_event_text && comment_depth == 0) {
+			gen_append_code(&code, ref_reader->text);
+			if (in_name && name == nullptr)
+				name = gen_copy(ref_reader->text);
+		}
+	}
+
+	if (name == nullptr) {
+		code.free();
+		free(parent);
+		return;
+	}
+	gen_printf(&code, "\n\n");
+	if (parent) gen_printf(&code, "Parent handle: %s\n", parent);
+	gen_specs.add({ name, spec_kind_type, gen_finish(&code) });
+	free(parent);
+}
+
+///////////////////////////////////////////
+
+void gen_read_enums(xml_reader_t *ref_reader, bool is_flags) {
+	char *type = gen_copy(xml_attr(ref_reader, "name"));
+	if (is_flags) gen_flag_types.add(type);
+	else          gen_enum_types.add(type);
+
+	int32_t    depth = 1;
+	xml_event_ event;
+	while (depth > 0 && (event = xml_next(ref_reader)) != xml_event_end) {
+		if (event == xml_event_open) {
+			if (strcmp(ref_reader->name, "enum") == 0)
+				gen_enums.add(gen_read_enum(ref_reader, type, 0));
+			if (!ref_reader->self_closing) depth++;
+		} else if (event == xml_event_close) {
+			depth--;
+		}
+	}
+}
+
+///////////////////////////////////////////
+
+gen_enum_t gen_read_enum(const xml_reader_t *reader, char *type, int32_t ext_number) {
+	gen_enum_t result = {};
+	result.type    = type;
+	result.name    = gen_copy(xml_attr(reader, "name"));
+	result.comment = gen_copy(xml_attr(reader, "comment"));
+
+	// Values are written out plainly, as a bit, or as an offset into the
+	// block of values that belongs to the extension.
+	const char *alias  = xml_attr(reader, "alias");
+	const char *value  = xml_attr(reader, "value");
+	const char *bitpos = xml_attr(reader, "bitpos");
+	const char *offset = xml_attr(reader, "offset");
+	char        number[32] = {};
+	if (alias) {
+		result.alias = true;
+		result.value = gen_copy(alias);
+	} else if (value) {
+		result.value = gen_copy(value);
+	} else if (bitpos) {
+		snprintf(number, sizeof(number), "0x%08llx", 1ull << atoi(bitpos));
+	} else if (offset) {
+		const char *extnumber = xml_attr(reader, "extnumber");
+		const char *dir       = xml_attr(reader, "dir");
+		int64_t     val       = 1000000000 + (int64_t)((extnumber ? atoi(extnumber) : ext_number) - 1) * 1000 + atoi(offset);
+		snprintf(number, sizeof(number), "%lld", (long long)(dir && dir[0] == '-' ? -val : val));
+	}
+	if (number[0]) result.value = gen_copy(number);
+	return result;
+}
+
+///////////////////////////////////////////
+
+void gen_read_command(xml_reader_t *ref_reader) {
+	const char *alias = xml_attr(ref_reader, "alias");
+	if (ref_reader->self_closing) {
+		if (alias) {
+			array_t<char> code = {};
+			gen_printf(&code, "Alias of %s\n", alias);
+			gen_specs.add({ gen_copy(xml_attr(ref_reader, "name")), spec_kind_command, gen_finish(&code) });
+		}
+		return;
+	}
+	char *success = gen_copy(xml_attr(ref_reader, "successcodes"));
+	char *errors  = gen_copy(xml_attr(ref_reader, "errorcodes"));
+
+	// <proto><type>XrResult</type> <name>xrFoo</name></proto>, then a
+	// <param> for each parameter, written out as a prototype.
+	array_t<char> code        = {};
+	char         *name        = nullptr;
+	int32_t       depth       = 1;
+	int32_t       param_count = 0;
+	bool          in_proto    = false;
+	bool          in_name     = false;
+	bool          skip        = false;
+	xml_event_    event;
+	while (depth > 0 && (event = xml_next(ref_reader)) != xml_event_end) {
+		if (event == xml_event_open) {
+			// These repeat params for the sake of thread safety notes
+			if (strcmp(ref_reader->name, "implicitexternsyncparams") == 0) skip = true;
+			if (strcmp(ref_reader->name, "proto") == 0) in_proto = true;
+			if (strcmp(ref_reader->name, "param") == 0 && !skip) {
+				gen_printf(&code, param_count == 0 ? "(\n    " : ",\n    ");
+				param_count++;
+			}
+			in_name = strcmp(ref_reader->name, "name") == 0;
+			if (!ref_reader->self_closing) depth++;
+		} else if (event == xml_event_close) {
+			if (strcmp(ref_reader->name, "implicitexternsyncparams") == 0) skip = false;
+			if (strcmp(ref_reader->name, "proto") == 0) in_proto = false;
+			in_name = false;
+			depth--;
+		} else if (event == xml_event_text && !skip) {
+			gen_append_code(&code, ref_reader->text);
+			if (in_proto && in_name && name == nullptr)
+				name = gen_copy(ref_reader->text);
+		}
+	}
+
+	if (name == nullptr) {
+		code.free();
+	} else {
+		gen_printf(&code, param_count == 0 ? "(void);\n\n" : ");\n\n");
+		if (success) gen_append_list(&code, "Success codes", success);
+		if (errors ) gen_append_list(&code, "Error codes",   errors);
+		gen_specs.add({ name, spec_kind_command, gen_finish(&code) });
+	}
+	free(success);
+	free(errors);
+}
+
+///////////////////////////////////////////
+
+void gen_read_extension(xml_reader_t *ref_reader, gen_extension_t *ref_ext) {
+	int32_t    depth = 1;
+	xml_event_ event;
+	while (depth > 0 && (event = xml_next(ref_reader)) != xml_event_end) {
+		if (event == xml_event_open) {
+			const char *name = xml_attr(ref_reader, "name");
+			if (name) {
+				if      (strcmp(ref_reader->name, "type"   ) == 0) ref_ext->types   .add(gen_copy(name));
+				else if (strcmp(ref_reader->name, "command") == 0) ref_ext->commands.add(gen_copy(name));
+				else if (strcmp(ref_reader->name, "enum"   ) == 0) {
+					// Only values added to an existing enum, the rest are
+					// constants like the spec version.
+					const char *extends = xml_attr(ref_reader, "extends");
+					if (extends)
+						ref_ext->enums.add(gen_read_enum(ref_reader, gen_copy(extends), ref_ext->number));
+				}
+			}
+			if (!ref_reader->self_closing) depth++;
+		} else if (event == xml_event_close) {
+			depth--;
+		}
+	}
+}
+
+///////////////////////////////////////////
+
+const gen_extension_t *gen_find_extension(const char *type) {
+	for (size_t e = 0; e < gen_extensions.count; e++) {
+		for (size_t t = 0; t < gen_extensions[e].types.count; t++) {
+			if (strcmp(gen_extensions[e].types[t], type) == 0) return &gen_extensions[e];
+		}
+	}
+	return nullptr;
+}
+
+///////////////////////////////////////////
+
+const gen_extension_t *gen_find_command(const char *command) {
+	for (size_t e = 0; e < gen_extensions.count; e++) {
+		for (size_t c = 0; c < gen_extensions[e].commands.count; c++) {
+			if (strcmp(gen_extensions[e].commands[c], command) == 0) return &gen_extensions[e];
+		}
+	}
+	return nullptr;
+}
+
+///////////////////////////////////////////
+
+bool gen_available(const char *type) {
+	// Types from disabled extensions aren't in the headers at all, and
+	// protected ones are only in openxr_platform.h with the right defines.
+	const gen_extension_t *ext = gen_find_extension(type);
+	return ext == nullptr || !(ext->disabled || ext->protect);
+}
+
+///////////////////////////////////////////
+// Output                                //
+///////////////////////////////////////////
+
+bool gen_write_properties(const char *folder) {
+	array_t<char> text = {};
+	gen_printf(&text, "// Generated by xrgenerator from xr.xml, don't edit!\n");
+	gen_printf(&text, "#pragma once\n\n");
+	gen_printf(&text, "// Every struct that extends XrSystemProperties, its XrStructureType, and\n");
+	gen_printf(&text, "// the extension it comes from, or nullptr if it's core.\n");
+	gen_printf(&text, "#define PROPERTIES_LIST(_) \\\n");
+
+	// Sorted by name, so the tables come out in a predictable order
+	gen_structs.sort([](const gen_struct_t &a, const gen_struct_t &b) { return strcmp(a.name, b.name); });
+	for (size_t s = 0; s < gen_structs.count; s++) {
+		if (!gen_available(gen_structs[s].name)) continue;
+		const gen_extension_t *ext = gen_find_extension(gen_structs[s].name);
+		if (gen_structs[s].structure_type == nullptr) {
+			printf("xrgenerator: %s has no XrStructureType, skipping it\n", gen_structs[s].name);
+			continue;
+		}
+
+		if (ext && ext->name) gen_printf(&text, "\t_(%s, %s, \"%s\") \\\n", gen_structs[s].name, gen_structs[s].structure_type, ext->name);
+		else                  gen_printf(&text, "\t_(%s, %s, nullptr) \\\n", gen_structs[s].name, gen_structs[s].structure_type);
+	}
+	gen_printf(&text, "\n");
+
+	// openxr_reflect.h needs these for the structs above, and the ones they
+	// hold. They're only names, so types the headers don't have are fine.
+	gen_printf(&text, "// Every XrBool32 member of every struct, as the struct and member name.\n");
+	gen_printf(&text, "#define BOOL_MEMBERS_LIST(_) \\\n");
+	for (size_t b = 0; b < gen_bools.count; b++)
+		gen_printf(&text, "\t_(%s, %s) \\\n", gen_bools[b].type, gen_bools[b].member);
+	gen_printf(&text, "\n");
+
+	bool result = gen_write_file(folder, "openxr_generated_properties.h", &text);
+	text.free();
+	return result;
+}
+
+///////////////////////////////////////////
+
+bool gen_write_enums(const char *folder) {
+	array_t<char> text = {};
+	gen_printf(&text, "// Generated by xrgenerator from xr.xml, don't edit!\n");
+	gen_printf(&text, "#pragma once\n\n");
+	gen_printf(&text, "// Every enum type in the registry.\n");
+	gen_printf(&text, "#define ENUM_TYPES_LIST(_) \\\n");
+	for (size_t i = 0; i < gen_enum_types.count; i++) {
+		if (gen_available(gen_enum_types[i]))
+			gen_printf(&text, "\t_(%s) \\\n", gen_enum_types[i]);
+	}
+	gen_printf(&text, "\n");
+
+	// Values come from the SDK's own headers by name, so these can't
+	// disagree with them.
+	gen_printf(&text, "// Every value of every enum, core and extension, as its type and name.\n");
+	gen_printf(&text, "#define ENUMS_LIST(_) \\\n");
+	for (size_t t = 0; t < gen_enum_types.count; t++) {
+		const char *type = gen_enum_types[t];
+		if (!gen_available(type)) continue;
+		for (size_t i = 0; i < gen_enums.count; i++) {
+			if (gen_enums[i].type == type && !gen_enums[i].alias)
+				gen_printf(&text, "\t_(%s, %s) \\\n", type, gen_enums[i].name);
+		}
+		for (size_t e = 0; e < gen_extensions.count; e++) {
+			const gen_extension_t *ext = &gen_extensions[e];
+			if (ext->disabled) continue;
+			for (size_t i = 0; i < ext->enums.count; i++) {
+				if (strcmp(ext->enums[i].type, type) == 0 && !ext->enums[i].alias)
+					gen_printf(&text, "\t_(%s, %s) \\\n", type, ext->enums[i].name);
+			}
+		}
+	}
+	gen_printf(&text, "\n");
+
+	bool result = gen_write_file(folder, "openxr_generated_enums.h", &text);
+	text.free();
+	return result;
+}
+
+///////////////////////////////////////////
+
+bool gen_write_dispatch(const char *folder) {
+	array_t<char> text = {};
+	gen_printf(&text, "// Generated by xrgenerator from xr.xml, don't edit!\n");
+	gen_printf(&text, "#pragma once\n\n");
+	gen_printf(&text, "// Every extension function, and the extension it comes from. Extensions\n");
+	gen_printf(&text, "// that need platform headers are left out.\n");
+	gen_printf(&text, "#define DISPATCH_LIST(_) \\\n");
+	// A few functions are required by more than one extension, but they
+	// can only be in the table once.
+	array_t<const char *> listed = {};
+	for (size_t e = 0; e < gen_extensions.count; e++) {
+		const gen_extension_t *ext = &gen_extensions[e];
+		if (ext->name == nullptr || ext->disabled || ext->protect) continue;
+		for (size_t c = 0; c < ext->commands.count; c++) {
+			bool found = false;
+			for (size_t i = 0; i < listed.count && !found; i++)
+				found = strcmp(listed[i], ext->commands[c]) == 0;
+			if (found) continue;
+			listed.add(ext->commands[c]);
+			gen_printf(&text, "\t_(%s, %s) \\\n", ext->name, ext->commands[c]);
+		}
+	}
+	listed.free();
+	gen_printf(&text, "\n");
+
+	bool result = gen_write_file(folder, "openxr_generated_dispatch.h", &text);
+	text.free();
+	return result;
+}
+
+///////////////////////////////////////////
+
+bool gen_write_spec(const char *folder) {
+	array_t<gen_spec_t> entries = {};
+	array_t<char>       text    = {};
+
+	// Types and functions, with where they came from. Disabled extensions
+	// are only placeholders, so there's nothing to say about theirs.
+	for (size_t i = 0; i < gen_specs.count; i++) {
+		const gen_spec_t      *spec = &gen_specs[i];
+		const gen_extension_t *ext  = spec->kind == spec_kind_command
+			? gen_find_command  (spec->name)
+			: gen_find_extension(spec->name);
+		if (ext && ext->disabled) continue;
+		gen_printf       (&text, "%s\n", spec->text);
+		gen_append_origin(&text, ext);
+		entries.add({ spec->name, spec->kind, gen_finish(&text) });
+	}
+
+	// Enums list all their values, and each value gets its own entry too,
+	// which links to the enum, since values don't have spec anchors.
+	for (size_t t = 0; t < gen_enum_types.count + gen_flag_types.count; t++) {
+		bool                   is_flags = t >= gen_enum_types.count;
+		char                  *type     = is_flags ? gen_flag_types[t - gen_enum_types.count] : gen_enum_types[t];
+		const gen_extension_t *type_ext = gen_find_extension(type);
+		if (type_ext && type_ext->disabled) continue;
+
+		if (is_flags) gen_printf(&text, "Bits of %s:\n", type);
+		else          gen_printf(&text, "typedef enum %s {\n", type);
+		for (size_t e = 0; e <= gen_extensions.count; e++) {
+			// Core values first, then each extension's
+			const gen_extension_t    *ext    = e == 0 ? nullptr : &gen_extensions[e - 1];
+			const array_t<gen_enum_t> &values = e == 0 ? gen_enums : ext->enums;
+			if (ext && ext->disabled) continue;
+			for (size_t i = 0; i < values.count; i++) {
+				const gen_enum_t *value = &values[i];
+				if (strcmp(value->type, type) != 0) continue;
+
+				gen_printf(&text, "    %s = %s,", value->name, value->value ? value->value : "?");
+				if (value->comment) gen_printf(&text, " // %s", value->comment);
+				gen_printf(&text, "\n");
+
+				array_t<char> value_text = {};
+				gen_printf(&value_text, "%s = %s\n\n", value->name, value->value ? value->value : "?");
+				gen_printf(&value_text, "%s: %s\n", is_flags ? "Flag bits" : "Enum", type);
+				gen_append_origin(&value_text, ext ? ext : type_ext);
+				if (value->comment) gen_printf(&value_text, "\n%s\n", value->comment);
+				entries.add({ value->name, spec_kind_value, gen_finish(&value_text), type });
+			}
+		}
+		if (!is_flags) gen_printf(&text, "} %s;\n", type);
+		gen_printf(&text, "\n");
+		gen_append_origin(&text, type_ext);
+		entries.add({ type, spec_kind_enum, gen_finish(&text) });
+	}
+
+	// Extensions and core versions, with everything they add
+	for (size_t e = 0; e < gen_extensions.count; e++) {
+		const gen_extension_t *ext = &gen_extensions[e];
+		if (ext->disabled || (ext->name == nullptr && ext->feature == nullptr)) continue;
+
+		gen_printf(&text, "%s\n", ext->spec);
+		if (ext->types.count > 0) {
+			gen_printf(&text, "Types:\n");
+			for (size_t i = 0; i < ext->types.count; i++) gen_printf(&text, "    %s\n", ext->types[i]);
+		}
+		if (ext->commands.count > 0) {
+			gen_printf(&text, "Functions:\n");
+			for (size_t i = 0; i < ext->commands.count; i++) gen_printf(&text, "    %s\n", ext->commands[i]);
+		}
+		if (ext->enums.count > 0) {
+			gen_printf(&text, "Values:\n");
+			for (size_t i = 0; i < ext->enums.count; i++) gen_printf(&text, "    %s\n", ext->enums[i].name);
+		}
+		entries.add({ ext->name ? ext->name : ext->feature, ext->name ? spec_kind_extension : spec_kind_version, gen_finish(&text) });
+	}
+
+	// Sorted the way openxr_spec.cpp searches it
+	entries.sort([](const gen_spec_t &a, const gen_spec_t &b) {
+		int32_t result = gen_compare_nocase(a.name, b.name);
+		return result != 0 ? result : (int32_t)a.kind - (int32_t)b.kind;
+	});
+
+	// Thousands of values share a few hundred anchors, so those are only
+	// stored once each.
+	struct anchor_t { const char *anchor; uint32_t offset; };
+	array_t<spec_file_entry_t> file_entries = {};
+	array_t<char>              strings      = {};
+	array_t<anchor_t>          anchors      = {};
+	for (size_t i = 0; i < entries.count; i++) {
+		spec_file_entry_t entry = {};
+		entry.kind = entries[i].kind;
+		entry.name = (uint32_t)strings.count;
+		strings.add_range(entries[i].name, strlen(entries[i].name) + 1);
+		entry.text = (uint32_t)strings.count;
+		strings.add_range(entries[i].text, strlen(entries[i].text) + 1);
+
+		entry.anchor = entry.name;
+		if (entries[i].anchor) {
+			size_t a = 0;
+			while (a < anchors.count && anchors[a].anchor != entries[i].anchor) a++;
+			if (a == anchors.count) {
+				anchors.add({ entries[i].anchor, (uint32_t)strings.count });
+				strings.add_range(entries[i].anchor, strlen(entries[i].anchor) + 1);
+			}
+			entry.anchor = anchors[a].offset;
+		}
+		file_entries.add(entry);
+	}
+
+	spec_file_header_t header = {};
+	memcpy(header.magic, spec_file_magic, sizeof(header.magic));
+	header.version     = spec_file_version;
+	header.entry_count = (uint32_t)file_entries.count;
+	header.string_size = (uint32_t)strings.count;
+
+	array_t<char> file = {};
+	file.add_range((const char *)&header, sizeof(header));
+	file.add_range((const char *)file_entries.data, file_entries.count * sizeof(spec_file_entry_t));
+	file.add_range(strings.data, strings.count);
+	bool result = gen_write_file(folder, spec_file_name, &file);
+	printf("xrgenerator: %d spec index entries, %d KB\n", (int32_t)entries.count, (int32_t)(file.count / 1024));
+
+	file.free();
+	anchors.free();
+	strings.free();
+	file_entries.free();
+	entries.free();
+	return result;
+}
+
+///////////////////////////////////////////
+
+bool gen_write_file(const char *folder, const char *name, const array_t<char> *text) {
+	char path[1024];
+	snprintf(path, sizeof(path), "%s/%s", folder, name);
+
+	// Files that didn't change are left alone, so nothing that includes
+	// them has to rebuild.
+	FILE *existing = fopen(path, "rb");
+	if (existing) {
+		fseek(existing, 0, SEEK_END);
+		long size = ftell(existing);
+		fseek(existing, 0, SEEK_SET);
+		bool same = false;
+		if (size == (long)text->count) {
+			char *data = (char *)malloc(size > 0 ? size : 1);
+			same = fread(data, 1, size, existing) == (size_t)size && memcmp(data, text->data, size) == 0;
+			free(data);
+		}
+		fclose(existing);
+		if (same) return true;
+	}
+
+	FILE *file = fopen(path, "wb");
+	if (file == nullptr) {
+		printf("xrgenerator: couldn't write %s\n", path);
+		return false;
+	}
+	fwrite(text->data, 1, text->count, file);
+	fclose(file);
+	return true;
+}
+
+///////////////////////////////////////////
+
+void gen_printf(array_t<char> *ref_text, const char *format, ...) {
+	va_list args;
+	va_start(args, format);
+	int32_t length = vsnprintf(nullptr, 0, format, args);
+	va_end(args);
+
+	if (ref_text->count + length + 1 > ref_text->capacity)
+		ref_text->resize((ref_text->count + length + 1) * 2);
+	va_start(args, format);
+	vsnprintf(ref_text->data + ref_text->count, length + 1, format, args);
+	va_end(args);
+	ref_text->count += length;
+}
+
+///////////////////////////////////////////
+
+void gen_append_code(array_t<char> *ref_text, const char *code) {
+	// The registry splits declarations up into tags, and drops the spaces
+	// between them, like <type>XrTime</type> <name>time</name>. Runs of
+	// whitespace become one space, and words that would touch get one.
+	auto is_word = [](char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_'; };
+	char last    = ref_text->count > 0 ? ref_text->data[ref_text->count - 1] : '\n';
+	if (is_word(last) && is_word(code[0])) ref_text->add(' ');
+
+	for (const char *c = code; *c; c++) {
+		last = ref_text->count > 0 ? ref_text->data[ref_text->count - 1] : '\n';
+		if (*c == ' ' || *c == '\t' || *c == '\r' || *c == '\n') {
+			if (last != ' ' && last != '\n' && last != '(') ref_text->add(' ');
+		} else {
+			ref_text->add(*c);
+		}
+	}
+}
+
+///////////////////////////////////////////
+
+void gen_append_list(array_t<char> *ref_text, const char *label, const char *list) {
+	// Registry lists are comma separated without spaces, which doesn't wrap
+	gen_printf(ref_text, "%s: ", label);
+	for (const char *c = list; *c; c++) {
+		ref_text->add(*c);
+		if (*c == ',') ref_text->add(' ');
+	}
+	ref_text->add('\n');
+}
+
+///////////////////////////////////////////
+
+void gen_append_origin(array_t<char> *ref_text, const gen_extension_t *ext) {
+	if      (ext == nullptr) return;
+	else if (ext->name)      gen_printf(ref_text, "Extension: %s\n", ext->name);
+	else if (ext->feature)   gen_printf(ref_text, "Version: %s\n",   ext->feature);
+}
+
+///////////////////////////////////////////
+
+char *gen_finish(array_t<char> *ref_text) {
+	// Hands the text over as a string, and the array starts over empty
+	while (ref_text->count > 0 && ref_text->data[ref_text->count - 1] == '\n')
+		ref_text->count--;
+	ref_text->add('\0');
+	char *result = ref_text->data;
+	*ref_text = {};
+	return result;
+}
+
+///////////////////////////////////////////
+
+int32_t gen_compare_nocase(const char *a, const char *b) {
+	// Plain ASCII, to match openxr_spec.cpp no matter the locale
+	for (;; a++, b++) {
+		char ca = *a >= 'A' && *a <= 'Z' ? *a + ('a' - 'A') : *a;
+		char cb = *b >= 'A' && *b <= 'Z' ? *b + ('a' - 'A') : *b;
+		if (ca != cb || ca == '\0')
+			return (int32_t)(uint8_t)ca - (int32_t)(uint8_t)cb;
+	}
+}
+
+///////////////////////////////////////////
+
+char *gen_copy(const char *text) {
+	if (text == nullptr) return nullptr;
+	size_t length = strlen(text) + 1;
+	char  *result = (char *)malloc(length);
+	memcpy(result, text, length);
+	return result;
+}
+
+///////////////////////////////////////////
+// XML reader                            //
+///////////////////////////////////////////
+
+bool xml_open(xml_reader_t *ref_reader, const char *file) {
+	ref_reader->file = fopen(file, "rb");
+	return ref_reader->file != nullptr;
+}
+
+///////////////////////////////////////////
+
+void xml_close(xml_reader_t *ref_reader) {
+	if (ref_reader->file) fclose(ref_reader->file);
+	ref_reader->scratch.free();
+	ref_reader->attrs  .free();
+	ref_reader->file = nullptr;
+}
+
+///////////////////////////////////////////
+
+int32_t xml_peekc(xml_reader_t *ref_reader) {
+	if (ref_reader->at >= ref_reader->count) {
+		ref_reader->count = fread(ref_reader->buffer, 1, sizeof(ref_reader->buffer), ref_reader->file);
+		ref_reader->at    = 0;
+		if (ref_reader->count == 0) return EOF;
+	}
+	return (uint8_t)ref_reader->buffer[ref_reader->at];
+}
+
+///////////////////////////////////////////
+
+int32_t xml_getc(xml_reader_t *ref_reader) {
+	int32_t c = xml_peekc(ref_reader);
+	if (c != EOF) ref_reader->at++;
+	return c;
+}
+
+///////////////////////////////////////////
+
+void xml_skip_to(xml_reader_t *ref_reader, const char *end) {
+	// Comments and declarations just need their end found
+	size_t length  = strlen(end);
+	size_t matched = 0;
+	int32_t c;
+	while (matched < length && (c = xml_getc(ref_reader)) != EOF) {
+		if      (c == end[matched]) matched++;
+		else if (c == end[0])       matched = 1;
+		else                        matched = 0;
+	}
+}
+
+///////////////////////////////////////////
+
+void xml_decode(array_t<char> *ref_text, size_t start) {
+	// Only the five entities XML itself defines show up in the registry
+	struct entity_t { const char *name; char c; };
+	const entity_t entities[] = { {"&lt;", '<'}, {"&gt;", '>'}, {"&amp;", '&'}, {"&quot;", '"'}, {"&apos;", '\''} };
+
+	size_t write = start;
+	for (size_t read = start; read < ref_text->count; ) {
+		char c = ref_text->data[read];
+		size_t used = 1;
+		if (c == '&') {
+			for (size_t e = 0; e < sizeof(entities)/sizeof(entities[0]); e++) {
+				size_t length = strlen(entities[e].name);
+				if (read + length <= ref_text->count && memcmp(&ref_text->data[read], entities[e].name, length) == 0) {
+					c    = entities[e].c;
+					used = length;
+					break;
+				}
+			}
+		}
+		ref_text->data[write++] = c;
+		read += used;
+	}
+	ref_text->count = write;
+}
+
+///////////////////////////////////////////
+
+xml_event_ xml_next(xml_reader_t *ref_reader) {
+	array_t<char> *scratch = &ref_reader->scratch;
+	scratch->clear();
+	ref_reader->attrs.clear();
+	ref_reader->name         = nullptr;
+	ref_reader->text         = nullptr;
+	ref_reader->self_closing = false;
+
+	int32_t c = xml_peekc(ref_reader);
+	if (c == EOF) return xml_event_end;
+
+	// Text runs up to the next tag. Runs that are only whitespace are
+	// just formatting, so they're skipped.
+	if (c != '<') {
+		bool blank = true;
+		while ((c = xml_peekc(ref_reader)) != EOF && c != '<') {
+			if (c != ' ' && c != '\t' && c != '\r' && c != '\n') blank = false;
+			scratch->add((char)xml_getc(ref_reader));
+		}
+		if (blank) return xml_next(ref_reader);
+		xml_decode(scratch, 0);
+		scratch->add('\0');
+		ref_reader->text = scratch->data;
+		return xml_event_text;
+	}
+
+	xml_getc(ref_reader); // <
+	c = xml_peekc(ref_reader);
+	if (c == '?') { xml_skip_to(ref_reader, "?>"); return xml_next(ref_reader); }
+	if (c == '!') {
+		xml_getc(ref_reader);
+		if (xml_peekc(ref_reader) == '-') xml_skip_to(ref_reader, "-->");
+		else                              xml_skip_to(ref_reader, ">");
+		return xml_next(ref_reader);
+	}
+
+	bool closing = c == '/';
+	if (closing) xml_getc(ref_reader);
+
+	// Names and attributes all go into scratch, null separated, and are
+	// only turned into pointers once it's done growing.
+	array_t<size_t> offsets = {};
+	offsets.add(0);
+	while ((c = xml_peekc(ref_reader)) != EOF && c != '>' && c != '/' && c != ' ' && c != '\t' && c != '\r' && c != '\n')
+		scratch->add((char)xml_getc(ref_reader));
+	scratch->add('\0');
+
+	while ((c = xml_getc(ref_reader)) != EOF && c != '>') {
+		if (c == '/') { ref_reader->self_closing = true; continue; }
+		if (c == ' ' || c == '\t' || c == '\r' || c == '\n') continue;
+
+		offsets.add(scratch->count);
+		scratch->add((char)c);
+		while ((c = xml_peekc(ref_reader)) != EOF && c != '=' && c != '>' && c != ' ')
+			scratch->add((char)xml_getc(ref_reader));
+		scratch->add('\0');
+		while ((c = xml_peekc(ref_reader)) == ' ' || c == '=') xml_getc(ref_reader);
+
+		int32_t quote = xml_getc(ref_reader);
+		size_t  start = scratch->count;
+		offsets.add(start);
+		while ((c = xml_getc(ref_reader)) != EOF && c != quote)
+			scratch->add((char)c);
+		xml_decode(scratch, start);
+		scratch->add('\0');
+	}
+
+	ref_reader->name = scratch->data + offsets[0];
+	for (size_t i = 1; i + 1 < offsets.count; i += 2)
+		ref_reader->attrs.add({ scratch->data + offsets[i], scratch->data + offsets[i + 1] });
+	offsets.free();
+
+	if (closing) return xml_event_close;
+	return xml_event_open;
+}
+
+///////////////////////////////////////////
+
+const char *xml_attr(const xml_reader_t *reader, const char *name) {
+	for (size_t i = 0; i < reader->attrs.count; i++) {
+		if (strcmp(reader->attrs[i].name, name) == 0)
+			return reader->attrs[i].value;
+	}
+	return nullptr;
+}
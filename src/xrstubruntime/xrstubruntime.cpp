@@ -0,0 +1,405 @@
+// A tiny OpenXR runtime that answers the explorer's queries from a snapshot
+// file captured with `openxr-explorer -capture <file>`. It doesn't track,
+// render or composite anything, it only replays enumerations and properties
+// so apps can be exercised against a real device's capability set without
+// the device.
+//
+// The snapshot is found via the XR_STUB_SNAPSHOT environment variable, or
+// as xrstubruntime.xrsnap next to this library. `openxr-explorer -replay`
+// sets that up automatically.
+
+#include "xrsnapshot.h"
+
+#include <openxr/openxr.h>
+#include <openxr/openxr_loader_negotiation.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#define STUB_EXPORT extern "C" __declspec(dllexport)
+#else
+#include <dlfcn.h>
+#include <libgen.h>
+#define STUB_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+/*** Types *******************************/
+
+struct stub_function_t {
+	const char        *name;
+	PFN_xrVoidFunction function;
+	bool               extension;
+};
+
+/*** Global Variables ********************/
+
+snapshot_t stub_snapshot        = {};
+bool       stub_snapshot_loaded = false;
+
+/*** Signatures **************************/
+
+bool     stub_load_snapshot();
+bool     stub_has_func     (const char *func);
+uint64_t stub_system_key   (XrSystemId system_id, uint64_t key);
+XrResult stub_enumerate    (const char *func, uint64_t key, uint32_t capacity, uint32_t *out_count, void *out_items, bool typed);
+XrResult stub_get_struct   (const char *func, uint64_t key, void *out_struct);
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrGetInstanceProcAddr(XrInstance instance, const char *name, PFN_xrVoidFunction *function);
+
+/*** Code ********************************/
+
+STUB_EXPORT XRAPI_ATTR XrResult XRAPI_CALL xrNegotiateLoaderRuntimeInterface(const XrNegotiateLoaderInfo *loader_info, XrNegotiateRuntimeRequest *runtime_request) {
+	if (loader_info     == nullptr || loader_info    ->structType != XR_LOADER_INTERFACE_STRUCT_LOADER_INFO    ||
+		runtime_request == nullptr || runtime_request->structType != XR_LOADER_INTERFACE_STRUCT_RUNTIME_REQUEST ||
+		loader_info->minInterfaceVersion > XR_CURRENT_LOADER_RUNTIME_VERSION ||
+		loader_info->maxInterfaceVersion < XR_CURRENT_LOADER_RUNTIME_VERSION)
+		return XR_ERROR_INITIALIZATION_FAILED;
+
+	if (!stub_load_snapshot())
+		return XR_ERROR_RUNTIME_UNAVAILABLE;
+
+	runtime_request->runtimeInterfaceVersion = XR_CURRENT_LOADER_RUNTIME_VERSION;
+	runtime_request->runtimeApiVersion       = XR_CURRENT_API_VERSION;
+	runtime_request->getInstanceProcAddr     = stub_xrGetInstanceProcAddr;
+	return XR_SUCCESS;
+}
+
+///////////////////////////////////////////
+
+bool stub_load_snapshot() {
+	if (stub_snapshot_loaded)
+		return true;
+
+	char        path[1024];
+	const char *env_path = getenv("XR_STUB_SNAPSHOT");
+	if (env_path != nullptr) {
+		snprintf(path, sizeof(path), "%s", env_path);
+	} else {
+#if defined(_WIN32)
+		HMODULE module = nullptr;
+		GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, (LPCSTR)&stub_load_snapshot, &module);
+		DWORD length = GetModuleFileNameA(module, path, sizeof(path));
+		while (length > 0 && path[length-1] != '\\' && path[length-1] != '/') length--;
+		snprintf(&path[length], sizeof(path) - length, "xrstubruntime.xrsnap");
+#else
+		Dl_info info = {};
+		char    lib_path[1024] = ".";
+		if (dladdr((void*)&stub_load_snapshot, &info) && info.dli_fname)
+			snprintf(lib_path, sizeof(lib_path), "%s", info.dli_fname);
+		snprintf(path, sizeof(path), "%s/xrstubruntime.xrsnap", dirname(lib_path));
+#endif
+	}
+
+	stub_snapshot_loaded = snapshot_load(path, &stub_snapshot);
+	if (!stub_snapshot_loaded)
+		fprintf(stderr, "xrstubruntime: couldn't load snapshot '%s'\n", path);
+	return stub_snapshot_loaded;
+}
+
+///////////////////////////////////////////
+
+bool stub_has_func(const char *func) {
+	uint64_t hash = snapshot_hash(func);
+	for (int32_t i = 0; i < stub_snapshot.record_count; i++) {
+		if (stub_snapshot.records[i].func_hash == hash && strcmp(stub_snapshot.records[i].func, func) == 0)
+			return true;
+	}
+	return false;
+}
+
+///////////////////////////////////////////
+
+// Each form factor gets its own system, and the XrSystemId is simply the
+// form factor, so per-system calls can find their way back to it. Sessions
+// do the same with the system they were made for.
+uint64_t stub_system_key(XrSystemId system_id, uint64_t key) {
+	return snapshot_system_key((uint32_t)system_id, key);
+}
+
+///////////////////////////////////////////
+
+// Typed OpenXR structs start with type and next, which belong to the caller,
+// so only the remainder of the struct is copied over.
+static void stub_copy_items(void *dest, const snapshot_record_t *record, uint32_t count, bool typed) {
+	if (!typed) {
+		memcpy(dest, record->data, (size_t)record->item_size * count);
+		return;
+	}
+	const size_t header = sizeof(XrBaseOutStructure);
+	if (record->item_size <= header) return;
+	for (uint32_t i = 0; i < count; i++) {
+		memcpy(
+			(      uint8_t*)dest         + (size_t)i * record->item_size + header,
+			(const uint8_t*)record->data + (size_t)i * record->item_size + header,
+			record->item_size - header);
+	}
+}
+
+///////////////////////////////////////////
+
+XrResult stub_enumerate(const char *func, uint64_t key, uint32_t capacity, uint32_t *out_count, void *out_items, bool typed) {
+	const snapshot_record_t *record = snapshot_find(&stub_snapshot, func, key);
+	if (record == nullptr)             return XR_ERROR_FUNCTION_UNSUPPORTED;
+	if (XR_FAILED(record->result))     return (XrResult)record->result;
+	if (out_count == nullptr)          return XR_ERROR_VALIDATION_FAILURE;
+
+	*out_count = record->item_count;
+	if (capacity == 0)                 return (XrResult)record->result;
+	if (capacity < record->item_count) return XR_ERROR_SIZE_INSUFFICIENT;
+
+	stub_copy_items(out_items, record, record->item_count, typed);
+	return (XrResult)record->result;
+}
+
+///////////////////////////////////////////
+
+XrResult stub_get_struct(const char *func, uint64_t key, void *out_struct) {
+	const snapshot_record_t *record = snapshot_find(&stub_snapshot, func, key);
+	if (record == nullptr)         return XR_ERROR_FUNCTION_UNSUPPORTED;
+	if (XR_FAILED(record->result)) return (XrResult)record->result;
+	if (record->item_count > 0)
+		stub_copy_items(out_struct, record, 1, true);
+	return (XrResult)record->result;
+}
+
+///////////////////////////////////////////
+// Core functions                        //
+///////////////////////////////////////////
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrEnumerateInstanceExtensionProperties(const char *layer_name, uint32_t capacity, uint32_t *count, XrExtensionProperties *properties) {
+	return stub_enumerate("xrEnumerateInstanceExtensionProperties", 0, capacity, count, properties, true);
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrCreateInstance(const XrInstanceCreateInfo *create_info, XrInstance *instance) {
+	// Replay API version rejections, so the explorer takes the same path
+	const snapshot_record_t *record = snapshot_find(&stub_snapshot, "xrCreateInstance", create_info->applicationInfo.apiVersion);
+	if (record != nullptr && XR_FAILED(record->result))
+		return (XrResult)record->result;
+	*instance = (XrInstance)1;
+	return XR_SUCCESS;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrDestroyInstance(XrInstance instance) {
+	return XR_SUCCESS;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrGetInstanceProperties(XrInstance instance, XrInstanceProperties *properties) {
+	XrResult result = stub_get_struct("xrGetInstanceProperties", 0, properties);
+	if (result == XR_ERROR_FUNCTION_UNSUPPORTED) {
+		properties->runtimeVersion = XR_MAKE_VERSION(1, 0, 0);
+		snprintf(properties->runtimeName, sizeof(properties->runtimeName), "OpenXR Explorer Stub");
+		result = XR_SUCCESS;
+	}
+	return result;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrGetSystem(XrInstance instance, const XrSystemGetInfo *get_info, XrSystemId *system_id) {
+	const snapshot_record_t *record = snapshot_find(&stub_snapshot, "xrGetSystem", get_info->formFactor);
+	if (record == nullptr)         return XR_ERROR_FORM_FACTOR_UNAVAILABLE;
+	if (XR_FAILED(record->result)) return (XrResult)record->result;
+	*system_id = (XrSystemId)get_info->formFactor;
+	return (XrResult)record->result;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrGetSystemProperties(XrInstance instance, XrSystemId system_id, XrSystemProperties *properties) {
+	XrResult result = stub_get_struct("xrGetSystemProperties", stub_system_key(system_id, XR_TYPE_SYSTEM_PROPERTIES), properties);
+	if (XR_FAILED(result)) return result;
+
+	// Fill out whatever was chained on that the snapshot knows about
+	XrBaseOutStructure *next = (XrBaseOutStructure *)properties->next;
+	while (next != nullptr) {
+		stub_get_struct("xrGetSystemProperties", stub_system_key(system_id, next->type), next);
+		next = next->next;
+	}
+	return result;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrEnumerateViewConfigurations(XrInstance instance, XrSystemId system_id, uint32_t capacity, uint32_t *count, XrViewConfigurationType *types) {
+	return stub_enumerate("xrEnumerateViewConfigurations", stub_system_key(system_id, 0), capacity, count, types, false);
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrGetViewConfigurationProperties(XrInstance instance, XrSystemId system_id, XrViewConfigurationType type, XrViewConfigurationProperties *properties) {
+	return stub_get_struct("xrGetViewConfigurationProperties", stub_system_key(system_id, type), properties);
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrEnumerateViewConfigurationViews(XrInstance instance, XrSystemId system_id, XrViewConfigurationType type, uint32_t capacity, uint32_t *count, XrViewConfigurationView *views) {
+	return stub_enumerate("xrEnumerateViewConfigurationViews", stub_system_key(system_id, type), capacity, count, views, true);
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrEnumerateEnvironmentBlendModes(XrInstance instance, XrSystemId system_id, XrViewConfigurationType type, uint32_t capacity, uint32_t *count, XrEnvironmentBlendMode *modes) {
+	return stub_enumerate("xrEnumerateEnvironmentBlendModes", stub_system_key(system_id, type), capacity, count, modes, false);
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrCreateSession(XrInstance instance, const XrSessionCreateInfo *create_info, XrSession *session) {
+	const snapshot_record_t *record = snapshot_find(&stub_snapshot, "xrCreateSession", 0);
+	if (record != nullptr && XR_FAILED(record->result))
+		return (XrResult)record->result;
+	*session = (XrSession)create_info->systemId;
+	return XR_SUCCESS;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrDestroySession(XrSession session) {
+	return XR_SUCCESS;
+}
+
+// Snapshots don't record events, so a replayed session never gets READY,
+// and the live tests time out instead of running.
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrPollEvent(XrInstance instance, XrEventDataBuffer *event) {
+	return XR_EVENT_UNAVAILABLE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrEnumerateReferenceSpaces(XrSession session, uint32_t capacity, uint32_t *count, XrReferenceSpaceType *spaces) {
+	return stub_enumerate("xrEnumerateReferenceSpaces", 0, capacity, count, spaces, false);
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrEnumerateSwapchainFormats(XrSession session, uint32_t capacity, uint32_t *count, int64_t *formats) {
+	return stub_enumerate("xrEnumerateSwapchainFormats", 0, capacity, count, formats, false);
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrPathToString(XrInstance instance, XrPath path, uint32_t capacity, uint32_t *count, char *buffer) {
+	XrResult result = stub_enumerate("xrPathToString", path, capacity, count, buffer, false);
+	return result == XR_ERROR_FUNCTION_UNSUPPORTED ? XR_ERROR_PATH_INVALID : result;
+}
+
+// Paths are made from a hash of their text, which is also what the
+// explorer keys interaction profile captures with.
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrStringToPath(XrInstance instance, const char *path_string, XrPath *path) {
+	if (path_string == nullptr || path_string[0] != '/') return XR_ERROR_PATH_FORMAT_INVALID;
+	*path = snapshot_hash(path_string);
+	return XR_SUCCESS;
+}
+
+// Action sets and actions don't do anything, they only need handles so
+// bindings can be suggested.
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrCreateActionSet(XrInstance instance, const XrActionSetCreateInfo *create_info, XrActionSet *action_set) {
+	*action_set = (XrActionSet)1;
+	return XR_SUCCESS;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrDestroyActionSet(XrActionSet action_set) {
+	return XR_SUCCESS;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrCreateAction(XrActionSet action_set, const XrActionCreateInfo *create_info, XrAction *action) {
+	*action = (XrAction)1;
+	return XR_SUCCESS;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrSuggestInteractionProfileBindings(XrInstance instance, const XrInteractionProfileSuggestedBinding *suggested_bindings) {
+	const snapshot_record_t *record = snapshot_find(&stub_snapshot, "xrSuggestInteractionProfileBindings", suggested_bindings->interactionProfile);
+	return record == nullptr ? XR_ERROR_PATH_UNSUPPORTED : (XrResult)record->result;
+}
+
+// The explorer only needs this to succeed before creating a session, so
+// one function covers every graphics API's requirements call.
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrGetGraphicsRequirements(XrInstance instance, XrSystemId system_id, void *requirements) {
+	return XR_SUCCESS;
+}
+
+///////////////////////////////////////////
+// Extension functions                   //
+///////////////////////////////////////////
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrEnumerateColorSpacesFB(XrSession session, uint32_t capacity, uint32_t *count, XrColorSpaceFB *color_spaces) {
+	return stub_enumerate("xrEnumerateColorSpacesFB", 0, capacity, count, color_spaces, false);
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrEnumerateDisplayRefreshRatesFB(XrSession session, uint32_t capacity, uint32_t *count, float *rates) {
+	return stub_enumerate("xrEnumerateDisplayRefreshRatesFB", 0, capacity, count, rates, false);
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrEnumerateRenderModelPathsFB(XrSession session, uint32_t capacity, uint32_t *count, XrRenderModelPathInfoFB *paths) {
+	return stub_enumerate("xrEnumerateRenderModelPathsFB", 0, capacity, count, paths, true);
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrEnumerateViveTrackerPathsHTCX(XrInstance instance, uint32_t capacity, uint32_t *count, XrViveTrackerPathsHTCX *paths) {
+	return stub_enumerate("xrEnumerateViveTrackerPathsHTCX", 0, capacity, count, paths, true);
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrEnumeratePerformanceMetricsCounterPathsMETA(XrInstance instance, uint32_t capacity, uint32_t *count, XrPath *paths) {
+	return stub_enumerate("xrEnumeratePerformanceMetricsCounterPathsMETA", 0, capacity, count, paths, false);
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrEnumerateReprojectionModesMSFT(XrInstance instance, XrSystemId system_id, XrViewConfigurationType type, uint32_t capacity, uint32_t *count, XrReprojectionModeMSFT *modes) {
+	return stub_enumerate("xrEnumerateReprojectionModesMSFT", stub_system_key(system_id, type), capacity, count, modes, false);
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrGetVisibilityMaskKHR(XrSession session, XrViewConfigurationType type, uint32_t view_index, XrVisibilityMaskTypeKHR mask_type, XrVisibilityMaskKHR *mask) {
+	// The explorer stores the vertex and index arrays as separate records
+	uint64_t key    = stub_system_key((XrSystemId)session, ((uint64_t)type << 16) | ((uint64_t)view_index << 8) | (uint64_t)mask_type);
+	XrResult result = stub_enumerate("xrGetVisibilityMaskKHR", key, mask->vertexCapacityInput, &mask->vertexCountOutput, mask->vertices, false);
+	if (XR_FAILED(result)) return result;
+	return stub_enumerate("xrGetVisibilityMaskKHR.indices", key, mask->indexCapacityInput, &mask->indexCountOutput, mask->indices, false);
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrEnumerateSceneComputeFeaturesMSFT(XrInstance instance, XrSystemId system_id, uint32_t capacity, uint32_t *count, XrSceneComputeFeatureMSFT *features) {
+	return stub_enumerate("xrEnumerateSceneComputeFeaturesMSFT", stub_system_key(system_id, 0), capacity, count, features, false);
+}
+
+///////////////////////////////////////////
+
+#define STUB_FUNCTION(name)     { #name, (PFN_xrVoidFunction)stub_##name, false }
+#define STUB_EXTENSION(name)    { #name, (PFN_xrVoidFunction)stub_##name, true  }
+#define STUB_GRAPHICS_REQ(name) { #name, (PFN_xrVoidFunction)stub_xrGetGraphicsRequirements, false }
+
+const stub_function_t stub_functions[] = {
+	STUB_FUNCTION (xrGetInstanceProcAddr),
+	STUB_FUNCTION (xrEnumerateInstanceExtensionProperties),
+	STUB_FUNCTION (xrCreateInstance),
+	STUB_FUNCTION (xrDestroyInstance),
+	STUB_FUNCTION (xrGetInstanceProperties),
+	STUB_FUNCTION (xrGetSystem),
+	STUB_FUNCTION (xrGetSystemProperties),
+	STUB_FUNCTION (xrEnumerateViewConfigurations),
+	STUB_FUNCTION (xrGetViewConfigurationProperties),
+	STUB_FUNCTION (xrEnumerateViewConfigurationViews),
+	STUB_FUNCTION (xrEnumerateEnvironmentBlendModes),
+	STUB_FUNCTION (xrCreateSession),
+	STUB_FUNCTION (xrDestroySession),
+	STUB_FUNCTION (xrPollEvent),
+	STUB_FUNCTION (xrEnumerateReferenceSpaces),
+	STUB_FUNCTION (xrEnumerateSwapchainFormats),
+	STUB_FUNCTION (xrPathToString),
+	STUB_FUNCTION (xrStringToPath),
+	STUB_FUNCTION (xrCreateActionSet),
+	STUB_FUNCTION (xrDestroyActionSet),
+	STUB_FUNCTION (xrCreateAction),
+	STUB_FUNCTION (xrSuggestInteractionProfileBindings),
+	STUB_GRAPHICS_REQ(xrGetOpenGLGraphicsRequirementsKHR),
+	STUB_GRAPHICS_REQ(xrGetOpenGLESGraphicsRequirementsKHR),
+	STUB_GRAPHICS_REQ(xrGetD3D11GraphicsRequirementsKHR),
+	STUB_GRAPHICS_REQ(xrGetD3D12GraphicsRequirementsKHR),
+	STUB_GRAPHICS_REQ(xrGetVulkanGraphicsRequirementsKHR),
+	STUB_EXTENSION(xrEnumerateColorSpacesFB),
+	STUB_EXTENSION(xrEnumerateDisplayRefreshRatesFB),
+	STUB_EXTENSION(xrEnumerateRenderModelPathsFB),
+	STUB_EXTENSION(xrEnumerateViveTrackerPathsHTCX),
+	STUB_EXTENSION(xrEnumeratePerformanceMetricsCounterPathsMETA),
+	STUB_EXTENSION(xrEnumerateReprojectionModesMSFT),
+	STUB_EXTENSION(xrEnumerateSceneComputeFeaturesMSFT),
+	STUB_EXTENSION(xrGetVisibilityMaskKHR),
+};
+
+///////////////////////////////////////////
+
+XRAPI_ATTR XrResult XRAPI_CALL stub_xrGetInstanceProcAddr(XrInstance instance, const char *name, PFN_xrVoidFunction *function) {
+	if (name == nullptr || function == nullptr)
+		return XR_ERROR_VALIDATION_FAILURE;
+
+	*function = nullptr;
+	for (size_t i = 0; i < sizeof(stub_functions)/sizeof(stub_functions[0]); i++) {
+		if (strcmp(stub_functions[i].name, name) != 0)
+			continue;
+
+		// Extension functions only exist if the captured runtime had them
+		if (stub_functions[i].extension && !stub_has_func(name))
+			return XR_ERROR_FUNCTION_UNSUPPORTED;
+		*function = stub_functions[i].function;
+		return XR_SUCCESS;
+	}
+	return XR_ERROR_FUNCTION_UNSUPPORTED;
+}